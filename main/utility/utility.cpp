@@ -19,6 +19,26 @@ void compress_spef(const std::filesystem::path& ori, const std::filesystem::path
   spef.dump_compact(ofs);
 }
 
+// Procedure: spef_to_binary
+void spef_to_binary(const std::filesystem::path& ori, const std::filesystem::path& bin) {
+  
+  spef::Spef spef;
+  spef.read(ori);
+
+  if(spef.error) {
+    OT_LOGF("spef error: ", spef.error.value());
+  }
+
+  // internal nodes are stored relative to their nets and share the same few strings
+  spef.localize_name();
+
+  OT_LOGI("converting spef ", ori, " to binary ", bin, " ...");
+
+  if(!ot::BinarySpef::write(spef, bin)) {
+    OT_LOGF("can't write ", bin);
+  }
+}
+
 // Procedure: timing_to_sdc
 void timing_to_sdc(const std::filesystem::path& timing, const std::filesystem::path& sdc) {
   
@@ -215,6 +235,7 @@ int main(int argc, char* argv[]) {
   std::vector<std::filesystem::path> t2s;
   std::vector<std::filesystem::path> o2s;
   std::vector<std::filesystem::path> spef;
+  std::vector<std::filesystem::path> s2b;
 
   app.add_option("--timing-to-sdc", t2s, "convert a TAU15 timing file to sdc format")
      ->expected(2);
@@ -225,6 +246,9 @@ int main(int argc, char* argv[]) {
   app.add_option("--compress-spef", spef, "compress a spef file")
      ->expected(2);
 
+  app.add_option("--spef-to-binary", s2b, "convert a spef file to the binary parasitics format")
+     ->expected(2);
+
   try {
     app.parse(argc, argv);
   }
@@ -249,6 +273,11 @@ int main(int argc, char* argv[]) {
     compress_spef(spef[0], spef[1]);
   }
 
+  // convert a spef file to binary
+  if(!s2b.empty()) {
+    spef_to_binary(s2b[0], s2b[1]);
+  }
+
   return 0;
 }
 
@@ -0,0 +1,10 @@
+#define OT_VERSION_MAJOR 2
+#define OT_VERSION_MINOR 1
+#define OT_VERSION_PATCH 0
+#define OT_VERSION "2.1.0"
+#define OT_HOME "/root/repo"
+#define OT_HOST_SYSTEM "Linux-6.18.44-fc-v139"
+#define OT_INSTALL_PREFIX "/usr/local"
+#define OT_TCLSH_PATH "/bin/tclsh"
+#define OT_WITH_ZLIB
+/* #undef OT_WITH_ZSTD */
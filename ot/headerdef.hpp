@@ -60,6 +60,7 @@
 
 // third-party include
 #include <ot/taskflow/taskflow.hpp>
+#include <ot/taskflow/algorithm/pipeline.hpp>
 #include <ot/json/json.hpp>
 #include <ot/parser-spef/parser-spef.hpp>
 #include <ot/unit/units.hpp>
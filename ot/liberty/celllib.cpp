@@ -2,104 +2,6 @@
 
 namespace ot {
 
-// Procedure: _uncomment
-void Celllib::_uncomment(std::vector<char>& buffer) {
-  
-  auto fsize = buffer.size() > 0 ? buffer.size() - 1 : 0;
-
-  // Mart out the comment
-  for(size_t i=0; i<fsize; ++i) {
-
-    // Block comment
-    if(buffer[i] == '/' && buffer[i+1] == '*') {
-      buffer[i] = buffer[i+1] = ' ';
-      for(i=i+2; i<fsize; buffer[i++]=' ') {
-        if(buffer[i] == '*' && buffer[i+1] == '/') {
-          buffer[i] = buffer[i+1] = ' ';
-          i = i+1;
-          break;
-        }
-      }
-    }
-    
-    // Line comment
-    if(buffer[i] == '/' && buffer[i+1] == '/') {
-      buffer[i] = buffer[i+1] = ' ';
-      for(i=i+2; i<fsize; ++i) {
-        if(buffer[i] == '\n' || buffer[i] == '\r') {
-          break;
-        }
-        else buffer[i] = ' ';
-      }
-    }
-    
-    // Pond comment
-    if(buffer[i] == '#') {
-      buffer[i] = ' ';
-      for(i=i+1; i<fsize; ++i) {
-        if(buffer[i] == '\n' || buffer[i] == '\r') {
-          break;
-        }
-        else buffer[i] = ' ';
-      }
-    }
-  }
-}
-
-// Procedure: _tokenize
-void Celllib::_tokenize(const std::vector<char>& buf, std::vector<std::string_view>& tokens) {
-
-  static std::string_view dels = "(),:;/#[]{}*\"\\";
-
-  // get the position
-  const char* beg = buf.data();
-  const char* end = buf.data() + buf.size();
-
-  // Parse the token.
-  const char *token {nullptr};
-  size_t len {0};
-
-  tokens.clear();
-
-  for(const char* itr = beg; itr != end && *itr != 0; ++itr) {
-    
-    // extract the entire quoted string as a token
-    bool is_del = (dels.find(*itr) != std::string_view::npos);
-
-    if(std::isspace(*itr) || is_del) {
-      if(len > 0) {                            // Add the current token.
-        tokens.push_back({token, len});
-        token = nullptr;
-        len = 0;
-      }
-      // group delimiter is liberty token
-      if(*itr == '(' || *itr == ')' || *itr == '{' || *itr == '}') {
-        tokens.push_back({itr, 1});
-      }
-      // extract the entire quoted string (this is buggy now...)
-      //else if(*itr == '"') {
-      //  for(++itr; itr != end && *itr != '"'; ++itr, ++len) ;
-      //  if(len > 0) {
-      //    tokens.push_back({itr-len, len});
-      //    len = 0;
-      //  }
-      //}
-    } 
-    else {
-      if(len == 0) {
-        token = itr;
-      }
-      ++len;
-    }
-  }
-
-  if(len > 0) {
-    tokens.push_back({token, len});
-  } 
-}
-
-// ------------------------------------------------------------------------------------------------
-
 // Function: to_string
 std::string to_string(DelayModel m) {
   switch(m) {
@@ -173,6 +75,146 @@ Cell* Celllib::cell(const std::string& name) {
   }
 }
 
+// Function: footprint
+const Footprint* Celllib::footprint(const std::string& name) const {
+  if(auto c = cell(name); c == nullptr) {
+    return nullptr;
+  }
+  else if(auto itr = footprints.find(_footprint_key(*c)); itr == footprints.end()) {
+    return nullptr;
+  }
+  else {
+    return &(itr->second);
+  }
+}
+
+// Function: _footprint_key
+// Cells without a cell_footprint attribute are keyed by their pin, function, and timing-arc 
+// signature so only cells with isomorphic arcs end up in the same group. Libraries without 
+// pin functions fall back to the cell name stem (e.g., NAND2 of NAND2_X1).
+std::string Celllib::_footprint_key(const Cell& cell) const {
+
+  if(!cell.cell_footprint.empty()) {
+    return cell.cell_footprint;
+  }
+
+  std::vector<std::string> pins;
+  bool has_function {false};
+
+  for(const auto& [name, cellpin] : cell.cellpins) {
+
+    auto pin = name + '(' + 
+      (cellpin.direction ? std::to_string(static_cast<int>(*cellpin.direction)) : "") + ')' +
+      cellpin.function + '|';
+
+    has_function = has_function || !cellpin.function.empty();
+
+    std::vector<std::string> arcs;
+
+    for(const auto& timing : cellpin.timings) {
+      arcs.push_back(
+        timing.related_pin + ':' +
+        (timing.sense ? to_string(*timing.sense) : "") + ':' +
+        (timing.type  ? to_string(*timing.type)  : "")
+      );
+    }
+
+    std::sort(arcs.begin(), arcs.end());
+
+    for(const auto& arc : arcs) {
+      pin += arc + ';';
+    }
+
+    pins.push_back(std::move(pin));
+  }
+
+  std::sort(pins.begin(), pins.end());
+
+  std::string key;
+
+  if(!has_function) {
+    key = cell.name.substr(0, cell.name.rfind('_')) + ' ';
+  }
+
+  for(const auto& pin : pins) {
+    key += pin + ' ';
+  }
+
+  return key;
+}
+
+// Function: _drive_resistance
+// Average output-transition slope with respect to the load over all output arcs; 
+// a smaller value means a stronger cell.
+float Celllib::_drive_resistance(const Cell& cell) const {
+
+  float sum {0.0f};
+  size_t num {0};
+
+  for(const auto& [name, cellpin] : cell.cellpins) {
+
+    if(cellpin.direction != CellpinDirection::OUTPUT && 
+       cellpin.direction != CellpinDirection::INOUT) {
+      continue;
+    }
+
+    for(const auto& timing : cellpin.timings) {
+
+      if(timing.is_constraint()) {
+        continue;
+      }
+
+      FOR_EACH_RF_RF_IF(irf, orf, timing.is_transition_defined(irf, orf)) {
+        auto lo = timing.slew(irf, orf, 0.0f, 0.0f);
+        auto hi = timing.slew(irf, orf, 0.0f, 1.0f);
+        if(lo && hi) {
+          sum += *hi - *lo;
+          ++num;
+        }
+      }
+    }
+  }
+
+  return num ? sum / num : std::numeric_limits<float>::max();
+}
+
+// Procedure: index_footprints
+// Group cells into footprints and presort each group by area and by drive strength.
+void Celllib::index_footprints() {
+  
+  footprints.clear();
+
+  std::unordered_map<const Cell*, float> resistance;
+
+  for(const auto& [name, cell] : cells) {
+    
+    auto& fp = footprints[_footprint_key(cell)];
+    fp.by_area.push_back(&cell);
+    fp.by_drive.push_back(&cell);
+    resistance[&cell] = _drive_resistance(cell);
+  }
+
+  auto area = [] (const Cell* c) {
+    return c->area ? *c->area : std::numeric_limits<float>::max();
+  };
+
+  for(auto& [key, fp] : footprints) {
+
+    std::sort(fp.by_area.begin(), fp.by_area.end(), [&] (auto a, auto b) {
+      return std::make_tuple(area(a), -resistance[a], std::string_view(a->name)) < 
+             std::make_tuple(area(b), -resistance[b], std::string_view(b->name));
+    });
+    
+    std::sort(fp.by_drive.begin(), fp.by_drive.end(), [&] (auto a, auto b) {
+      return std::make_tuple(-resistance[a], area(a), std::string_view(a->name)) < 
+             std::make_tuple(-resistance[b], area(b), std::string_view(b->name));
+    });
+
+    // name a signature group after its smallest cell
+    fp.name = fp.by_area[0]->cell_footprint.empty() ? fp.by_area[0]->name : key;
+  }
+}
+
 // Function: _extract_operating_conditions
 std::optional<float> Celllib::_extract_operating_conditions(token_iterator& itr, const token_iterator end) {
 
@@ -604,6 +646,21 @@ Cellpin Celllib::_extract_cellpin(token_iterator& itr, const token_iterator end)
       OT_LOGF_IF(++itr == end, "can't get the clock status in cellpin ", cellpin.name);
       cellpin.is_clock = (*itr == "true") ? true : false;
     }
+    else if(*itr == "function") {
+      OT_LOGF_IF(++itr == end, "can't get the function in cellpin ", cellpin.name);
+      // the expression is split into several tokens; recover it from the buffer
+      auto beg = itr->data();
+      auto fin = beg;
+      while(*fin != '"' && *fin != ';' && *fin != '\n' && *fin != 0) {
+        ++fin;
+      }
+      while(std::next(itr) != end && std::next(itr)->data() < fin) {
+        ++itr;
+      }
+      cellpin.function.assign(beg, fin);
+      cellpin.function.erase(cellpin.function.find_last_not_of(" \t\r") + 1);
+      cellpin.logic_function = compile_logic_function(cellpin.function);
+    }
     else if(*itr == "original_pin") {
       OT_LOGF_IF(++itr == end, "can't get the original pin in cellpin ", cellpin.name);
       cellpin.original_pin = *itr;
@@ -717,23 +774,23 @@ Cell Celllib::_extract_cell(token_iterator& itr, const token_iterator end) {
 // Procedure: read
 void Celllib::read(const std::filesystem::path& path) {
   
-  std::ifstream ifs(path, std::ios::ate);
-  
-  // return on failure
-  OT_LOGF_IF(!ifs, "failed to open celllib ", path);
-
-  size_t fsize = ifs.tellg();
-  ifs.seekg(0, std::ios::beg);
-  std::vector<char> buffer(fsize + 1);
-  ifs.read(buffer.data(), fsize);
-  buffer[fsize] = 0;
+  MappedFile file;
+  std::optional<std::string> content;
 
-  // get tokens
-  std::vector<std::string_view> tokens;
-  tokens.reserve(buffer.size() / sizeof(std::string));
+  // a library is a single group and is decompressed as a whole
+  if(compression(path) != Compression::NONE) {
+    content = decompress(path);
+    OT_LOGF_IF(!content, "failed to decompress celllib ", path);
+  }
+  else {
+    file.open(path);
+    OT_LOGF_IF(!file.is_open(), "failed to open celllib ", path);
+  }
 
-  _uncomment(buffer);
-  _tokenize (buffer, tokens);
+  // get tokens (views into the mapped file)
+  auto tokens = tokenize(
+    content ? std::string_view(*content) : file.view(), "(),:;/#[]{}*\"\\", "(){}"
+  );
 
   // Set up the iterator
   auto itr = tokens.begin();
@@ -28,6 +28,15 @@ inline const std::unordered_map<std::string_view, DelayModel> delay_models {
 // Function: to_string
 std::string to_string(DelayModel);
 
+// Struct: Footprint
+// A group of interchangeable cells (same footprint or pin/arc signature)
+// presorted for repower candidate lookups.
+struct Footprint {
+  std::string name;
+  std::vector<const Cell*> by_area;     // ascending area
+  std::vector<const Cell*> by_drive;    // ascending drive strength
+};
+
 // Class: Celllib
 struct Celllib {
   
@@ -56,8 +65,10 @@ struct Celllib {
 
   std::unordered_map<std::string, LutTemplate> lut_templates;
   std::unordered_map<std::string, Cell> cells;
+  std::unordered_map<std::string, Footprint> footprints;
 
   void read(const std::filesystem::path&);
+  void index_footprints();
   void scale_time(float);
   void scale_resistance(float);
   void scale_power(float);
@@ -67,6 +78,7 @@ struct Celllib {
 
   const LutTemplate* lut_template(const std::string&) const;
   const Cell* cell(const std::string&) const;
+  const Footprint* footprint(const std::string&) const;
   
   LutTemplate* lut_template(const std::string&);
   Cell* cell(const std::string&);
@@ -82,8 +94,8 @@ struct Celllib {
     Timing        _extract_timing        (token_iterator&, const token_iterator);
 
     void _apply_default_values();
-    void _uncomment(std::vector<char>&);
-    void _tokenize(const std::vector<char>&, std::vector<std::string_view>&);
+    std::string _footprint_key(const Cell&) const;
+    float _drive_resistance(const Cell&) const;
 };
 
 // Operator <<
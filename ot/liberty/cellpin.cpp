@@ -97,6 +97,11 @@ std::ostream& operator << (std::ostream& os, const Cellpin& p) {
     os << "    capacitance : " << (*p.capacitance) << ";\n";
   }
 
+  // Write the logic function.
+  if(!p.function.empty()) {
+    os << "    function : \"" << p.function << "\";\n";
+  }
+
   // Write the clock flag.
   if(p.is_clock) {
     os << "    clock : " << (*(p.is_clock) ? "true" : "false") << ";\n";
@@ -3,6 +3,7 @@
 
 #include <ot/liberty/timing.hpp>
 #include <ot/liberty/power.hpp>
+#include <ot/liberty/function.hpp>
 
 namespace ot {
 
@@ -26,6 +27,9 @@ struct Cellpin {
 
   std::string name;
   std::string original_pin;
+  std::string function;
+
+  std::optional<LogicFunction> logic_function;  // compiled function (see compile_logic_function)
 
   std::optional<CellpinDirection> direction;
   std::optional<float> capacitance;      // Pin capacitance
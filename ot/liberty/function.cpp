@@ -0,0 +1,232 @@
+#include <ot/liberty/function.hpp>
+
+namespace ot {
+
+// Class: LogicFunctionParser
+// Recursive-descent parser of a liberty function to a postfix program. The operators, from the
+// lowest to the highest precedence, are: or (+, |), and (&, *, or a space), xor (^), and not
+// (the prefix ! or the postfix ').
+class LogicFunctionParser {
+
+  friend std::optional<LogicFunction> compile_logic_function(std::string_view);
+
+  enum Op {
+    VARIABLE,
+    ZERO,
+    ONE,
+    NOT,
+    AND,
+    OR,
+    XOR
+  };
+
+  public:
+
+    LogicFunctionParser(std::string_view);
+
+  private:
+
+    std::string_view _expr;
+
+    size_t _cursor {0};
+
+    bool _failed {false};
+
+    std::vector<std::string> _variables;
+    std::vector<std::pair<Op, size_t>> _program;
+
+    bool _accept(std::string_view);
+    bool _is_factor() const;
+    bool _is_symbol(char) const;
+
+    void _skip();
+    void _or();
+    void _and();
+    void _xor();
+    void _not();
+    void _primary();
+};
+
+// Constructor
+LogicFunctionParser::LogicFunctionParser(std::string_view expr) : _expr {expr} {
+  _or();
+  _skip();
+  _failed = _failed || _cursor != _expr.size();
+}
+
+// Procedure: _skip
+void LogicFunctionParser::_skip() {
+  while(_cursor < _expr.size() && std::isspace(_expr[_cursor])) {
+    ++_cursor;
+  }
+}
+
+// Function: _accept
+// Consume the next character if it is one of the given operators.
+bool LogicFunctionParser::_accept(std::string_view ops) {
+  _skip();
+  if(_cursor < _expr.size() && ops.find(_expr[_cursor]) != std::string_view::npos) {
+    ++_cursor;
+    return true;
+  }
+  return false;
+}
+
+// Function: _is_symbol
+bool LogicFunctionParser::_is_symbol(char c) const {
+  return std::isalnum(c) || c == '_' || c == '[' || c == ']' || c == '.';
+}
+
+// Function: _is_factor
+// Whether the next character begins a factor (and an implicit and by a space).
+bool LogicFunctionParser::_is_factor() const {
+  return _cursor < _expr.size() &&
+         (_expr[_cursor] == '(' || _expr[_cursor] == '!' || _is_symbol(_expr[_cursor]));
+}
+
+// Procedure: _or
+void LogicFunctionParser::_or() {
+  _and();
+  while(!_failed && _accept("+|")) {
+    _and();
+    _program.emplace_back(OR, 0);
+  }
+}
+
+// Procedure: _and
+void LogicFunctionParser::_and() {
+  _xor();
+  while(!_failed) {
+    if(_accept("&*")) {
+      _xor();
+    }
+    else if(_is_factor()) {
+      _xor();
+    }
+    else break;
+    _program.emplace_back(AND, 0);
+  }
+}
+
+// Procedure: _xor
+void LogicFunctionParser::_xor() {
+  _not();
+  while(!_failed && _accept("^")) {
+    _not();
+    _program.emplace_back(XOR, 0);
+  }
+}
+
+// Procedure: _not
+void LogicFunctionParser::_not() {
+
+  if(_accept("!")) {
+    _not();
+    _program.emplace_back(NOT, 0);
+    return;
+  }
+
+  _primary();
+
+  while(!_failed && _accept("'")) {
+    _program.emplace_back(NOT, 0);
+  }
+}
+
+// Procedure: _primary
+void LogicFunctionParser::_primary() {
+
+  if(_failed) {
+    return;
+  }
+
+  if(_accept("(")) {
+    _or();
+    _failed = _failed || !_accept(")");
+    return;
+  }
+
+  auto beg = _cursor;
+
+  while(_cursor < _expr.size() && _is_symbol(_expr[_cursor])) {
+    ++_cursor;
+  }
+
+  if(beg == _cursor) {
+    _failed = true;
+    return;
+  }
+
+  auto symbol = _expr.substr(beg, _cursor - beg);
+
+  if(symbol == "0" || symbol == "1") {
+    _program.emplace_back(symbol == "0" ? ZERO : ONE, 0);
+    return;
+  }
+
+  auto itr = std::find(_variables.begin(), _variables.end(), symbol);
+
+  if(itr == _variables.end()) {
+    itr = _variables.emplace(_variables.end(), symbol);
+  }
+
+  _program.emplace_back(VARIABLE, itr - _variables.begin());
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Function: compile_logic_function
+// Compile a liberty function to the truth table. The compilation fails on a syntax error or a
+// function of more than LogicFunction::MAX_VARIABLES variables.
+std::optional<LogicFunction> compile_logic_function(std::string_view expr) {
+
+  LogicFunctionParser parser(expr);
+
+  if(parser._failed || parser._program.empty() ||
+     parser._variables.size() > LogicFunction::MAX_VARIABLES) {
+    return std::nullopt;
+  }
+
+  LogicFunction func;
+
+  func.variables = std::move(parser._variables);
+  func.truth_table.resize(size_t{1} << func.variables.size());
+
+  std::vector<bool> stack;
+
+  for(size_t a=0; a<func.truth_table.size(); ++a) {
+
+    for(const auto& [op, v] : parser._program) {
+      switch(op) {
+        case LogicFunctionParser::VARIABLE:
+          stack.push_back((a >> v) & 1);
+        break;
+
+        case LogicFunctionParser::ZERO:
+        case LogicFunctionParser::ONE:
+          stack.push_back(op == LogicFunctionParser::ONE);
+        break;
+
+        case LogicFunctionParser::NOT:
+          stack.back() = !stack.back();
+        break;
+
+        default: {
+          bool r = stack.back();
+          stack.pop_back();
+          bool l = stack.back();
+          stack.back() = (op == LogicFunctionParser::AND) ? (l && r) :
+                         (op == LogicFunctionParser::OR ) ? (l || r) : (l != r);
+        }
+        break;
+      }
+    }
+
+    func.truth_table[a] = stack.back();
+    stack.clear();
+  }
+
+  return func;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
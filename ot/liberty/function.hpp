@@ -0,0 +1,31 @@
+#ifndef OT_LIBERTY_FUNCTION_HPP_
+#define OT_LIBERTY_FUNCTION_HPP_
+
+#include <ot/headerdef.hpp>
+
+namespace ot {
+
+// Struct: LogicFunction
+// The boolean function of a cellpin (the liberty attribute "function") compiled to the truth
+// table over its variables. Bit i of an assignment (the index to the truth table) is the value
+// of the i-th variable.
+struct LogicFunction {
+
+  constexpr static size_t MAX_VARIABLES = 16;
+
+  std::vector<std::string> variables;
+  std::vector<bool> truth_table;
+
+  inline bool operator () (size_t) const;
+};
+
+// Function: operator ()
+inline bool LogicFunction::operator () (size_t assignment) const {
+  return truth_table[assignment];
+}
+
+std::optional<LogicFunction> compile_logic_function(std::string_view);
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
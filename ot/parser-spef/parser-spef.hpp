@@ -16,6 +16,8 @@
 #include <filesystem>
 #include <fstream>
 #include <cmath>
+#include <thread>
+#include <atomic>
 
 #include "pegtl/pegtl.hpp"
 
@@ -121,13 +123,16 @@ struct Spef {
   void dump(std::ostream&) const;
   void dump_compact(std::ostream&) const;
   void clear();
-  void expand_name();
+  void expand_name(size_t = std::thread::hardware_concurrency());
   void expand_name(Net&);
   void expand_name(Port&);
+  void localize_name(size_t = std::thread::hardware_concurrency());
+  void localize_name(Net&) const;
   void scale_capacitance(float);
   void scale_resistance(float);
   
   bool read(const std::filesystem::path &);
+  bool read(char*, size_t, size_t = std::thread::hardware_concurrency());
 
   template <typename T>
   friend struct Action;
@@ -136,6 +141,8 @@ struct Spef {
   
     Net* _current_net {nullptr};
     std::vector<std::string_view> _tokens;
+
+    bool _parse(char*, size_t);
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -174,6 +181,56 @@ namespace double_
 };
 
 
+// Procedure: parallel_for
+// Applies the callable to every index in [0, N) using up to T threads.
+template <typename C>
+void parallel_for(size_t N, size_t T, C&& c) {
+
+  T = std::min(std::max<size_t>(T, 1), N);
+
+  if(T <= 1) {
+    for(size_t i=0; i<N; ++i) {
+      c(i);
+    }
+    return;
+  }
+
+  const size_t grain = std::max<size_t>(1, N / (T * 16));
+  std::atomic<size_t> next {0};
+
+  auto worker = [&] () {
+    for(size_t b; (b = next.fetch_add(grain, std::memory_order_relaxed)) < N; ) {
+      for(size_t i=b, e=std::min(b + grain, N); i<e; ++i) {
+        c(i);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(T - 1);
+  for(size_t t=1; t<T; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+
+  for(auto& t : threads) {
+    t.join();
+  }
+}
+
+// Function: find_net
+// Returns the position of the first *D_NET at the beginning of a line starting from pos, or the 
+// size of the buffer if there is none.
+inline size_t find_net(const char* buffer, size_t size, size_t pos) {
+  std::string_view view(buffer, size);
+  for(; (pos = view.find("*D_NET", pos)) != std::string_view::npos; ++pos) {
+    if(pos == 0 || buffer[pos-1] == '\n') {
+      return pos;
+    }
+  }
+  return size;
+}
+
 // Function: split_on_space 
 inline void split_on_space(const char* beg, const char* end, std::vector<std::string_view>& tokens) {
 
@@ -1182,11 +1239,76 @@ inline bool Spef::read(const std::filesystem::path &p){
     return false;
   }
 
+  return read(buffer.data(), buffer.size());
+}
+
+// Function: read
+// Parses an in-memory buffer (e.g., a memory-mapped file); comments are blanked in place.
+// The header sections (up to the first *D_NET) are parsed first. The nets are then split into
+// chunks at *D_NET boundaries, parsed concurrently, and appended in order.
+inline bool Spef::read(char* buffer, size_t size, size_t num_threads){
+
+  if(size == 0){
+    return false;
+  }
+
+  // positions of the header and chunks of nets
+  std::vector<size_t> cuts {0, find_net(buffer, size, 0)};
+
+  const size_t body = size - cuts[1];
+  const size_t num_chunks = std::clamp<size_t>(body >> 18, 1, std::max<size_t>(num_threads, 1));
+
+  for(size_t i=1; i<num_chunks; ++i) {
+    if(auto pos = find_net(buffer, size, cuts[1] + body / num_chunks * i); 
+       pos > cuts.back() && pos < size) {
+      cuts.push_back(pos);
+    }
+  }
+  cuts.push_back(size);
+  
+  if(!_parse(buffer, cuts[1])) {
+    return false;
+  }
+
+  if(cuts[1] == size) {
+    return true;
+  }
+
+  std::vector<Spef> chunks(cuts.size() - 2);
+
+  parallel_for(chunks.size(), num_threads, [&] (size_t i) {
+    chunks[i]._parse(buffer + cuts[i+1], cuts[i+2] - cuts[i+1]);
+  });
+
+  size_t num_nets {nets.size()};
+
+  for(size_t i=0; i<chunks.size(); ++i) {
+    // error lines are local to the chunk
+    if(chunks[i].error) {
+      error = std::move(chunks[i].error);
+      error->line_number += std::count(buffer, buffer + cuts[i+1], '\n');
+      return false;
+    }
+    num_nets += chunks[i].nets.size();
+  }
+
+  nets.reserve(num_nets);
+
+  for(auto& chunk : chunks) {
+    std::move(chunk.nets.begin(), chunk.nets.end(), std::back_inserter(nets));
+  }
+
+  return true;
+}
+
+// Function: _parse
+inline bool Spef::_parse(char* buffer, size_t size){
+
   // Remove comments 
-  for(size_t i=0; i<buffer.size(); i++){
-    if(buffer[i] == '/' && i+1 < buffer.size() && buffer[i+1] == '/') {
+  for(size_t i=0; i<size; i++){
+    if(buffer[i] == '/' && i+1 < size && buffer[i+1] == '/') {
       buffer[i] = buffer[i+1] = ' ';
-      for(i=i+2; i<buffer.size(); ++i) {
+      for(i=i+2; i<size; ++i) {
         if(buffer[i] == '\n' || buffer[i] == '\r') {
           break;
         }
@@ -1196,7 +1318,7 @@ inline bool Spef::read(const std::filesystem::path &p){
   }
 
   // Use Lazy mode to avoid performance hit!!! (very important...)
-  tao::pegtl::memory_input<pegtl::tracking_mode::LAZY> in(buffer, "");
+  tao::pegtl::memory_input<pegtl::tracking_mode::LAZY> in(buffer, size, "");
 
   try{
     tao::pegtl::parse<spef::RuleSpef, spef::Action, spef::Control>(in, *this);
@@ -1241,7 +1363,7 @@ inline void expand_string(std::string& str,
 }
 
 // Procedure: expand all mappings in the SPEF file
-inline void Spef::expand_name(){
+inline void Spef::expand_name(size_t num_threads){
 
   if(name_map.empty()) {
     return;
@@ -1251,9 +1373,10 @@ inline void Spef::expand_name(){
     expand_name(p);
   }
 
-  for(auto &n: nets){
-    expand_name(n);
-  }
+  // nets are independent of each other
+  parallel_for(nets.size(), num_threads, [&] (size_t i) {
+    expand_name(nets[i]);
+  });
 
   name_map.clear();
 }
@@ -1284,6 +1407,69 @@ inline void Spef::expand_name(Net& net){
   }
 }
 
+// Procedure: localize the mapping in all nets (see localize_name(Net&))
+inline void Spef::localize_name(size_t num_threads){
+
+  for(auto &p: ports){
+    expand_name(p);
+  }
+
+  parallel_for(nets.size(), num_threads, [&] (size_t i) {
+    localize_name(nets[i]);
+  });
+
+  name_map.clear();
+}
+
+// Procedure: localize the mapping in a net
+// Same as expand_name except the internal nodes of the net (e.g., *3:1 in net *3) are 
+// rewritten relative to the net (:1) instead of being expanded to full hierarchical names.
+// Internal nodes make up most of the names in a parasitics file but are only meaningful 
+// within their net; a full name is the net name followed by the local name.
+inline void Spef::localize_name(Net& net) const {
+
+  const std::string& ref = net.name;
+  const char delim = delimiter.empty() ? ':' : delimiter[0];
+
+  auto is_local = [&] (const std::string& node) {
+    return node.size() > ref.size() && node[ref.size()] == delim && 
+           node.compare(0, ref.size(), ref) == 0;
+  };
+
+  // pins looking like internal nodes (of an instance named as the net) keep their full names
+  std::vector<std::string_view> pins;
+  for(const auto& c : net.connections) {
+    if(is_local(c.name)) {
+      pins.push_back(c.name);
+    }
+  }
+
+  auto localize = [&] (std::string& node) {
+    if(is_local(node) && std::find(pins.begin(), pins.end(), node) == pins.end()) {
+      node.erase(0, ref.size());
+    }
+    else {
+      expand_string(node, name_map);
+    }
+  };
+
+  for(auto &t: net.caps){
+    localize(std::get<0>(t));
+    localize(std::get<1>(t));
+  }
+
+  for(auto &r: net.ress){
+    localize(std::get<0>(r));
+    localize(std::get<1>(r));
+  }
+
+  expand_string(net.name, name_map);
+  for(auto &c : net.connections){
+    expand_string(c.name, name_map);
+    expand_string(c.driving_cell, name_map);
+  }
+}
+
 
 }; // end of namespace spef. ----------------------------------------------------------------------
 
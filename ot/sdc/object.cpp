@@ -3,6 +3,8 @@
 namespace ot::sdc {
 
 // Function: parse_port
+// Parse an evaluated object query. Port patterns come bare (e.g., "in1 in2") and any other
+// query is prefixed by its command and options (e.g., "get_pins -regexp u1/.*").
 Object parse_port(const std::string& line) {
 
   if(line.find("all_inputs") != std::string::npos) {
@@ -19,13 +21,36 @@ Object parse_port(const std::string& line) {
   auto end = std::sregex_token_iterator();
   //auto num = std::distance(itr, end);
 
-  GetPorts get_ports;
+  std::vector<std::string> patterns;
+  std::string query {"get_ports"};
+  bool regexp {false};
 
   for(; itr != end; ++itr) {
-    get_ports.ports.push_back(itr->str());
+    if(auto token = itr->str(); token.empty()) {
+      continue;
+    }
+    else if(patterns.empty() && token.compare(0, 4, "get_") == 0) {
+      query = std::move(token);
+    }
+    else if(patterns.empty() && token == "-regexp") {
+      regexp = true;
+    }
+    else {
+      patterns.push_back(std::move(token));
+    }
+  }
+
+  if(query == "get_pins") {
+    return GetPins{std::move(patterns), regexp};
+  }
+  else if(query == "get_cells") {
+    return GetCells{std::move(patterns), regexp};
+  }
+  else if(query == "get_nets") {
+    return GetNets{std::move(patterns), regexp};
   }
   
-  return get_ports;
+  return GetPorts{std::move(patterns), regexp};
 }
 
 };  // end of namespace sdc. ----------------------------------------------------------------------
@@ -23,18 +23,22 @@ struct AllOutputs {
 
 struct GetPorts {
   std::vector<std::string> ports;
+  bool regexp {false};
 };
 
 struct GetCells {
   std::vector<std::string> cells;
+  bool regexp {false};
 };
 
 struct GetPins {
   std::vector<std::string> pins;
+  bool regexp {false};
 };
 
 struct GetNets {
   std::vector<std::string> nets;
+  bool regexp {false};
 };
 
 struct GetLibs {
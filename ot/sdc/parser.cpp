@@ -0,0 +1,311 @@
+#include <ot/sdc/sdc.hpp>
+
+namespace ot::sdc {
+
+// Struct: Syntax
+// The options and positional parameters of a natively supported command, following the
+// declarations in sdc2.0.tcl.
+struct Syntax {
+  std::vector<std::string_view> flags;
+  std::vector<std::string_view> options;
+  std::vector<std::string_view> positionals;
+};
+
+// Function: find_syntax
+// Return the syntax of a command or nullptr if the command is not supported natively.
+const Syntax* find_syntax(std::string_view command) {
+
+  static const std::unordered_map<std::string_view, Syntax> syntaxes {
+    {"create_clock", {
+      {"-add"},
+      {"-period", "-name", "-comment", "-waveform"},
+      {"port_pin_list"}
+    }},
+    {"set_input_delay", {
+      {"-clock_fall", "-level_sensitive", "-rise", "-fall", "-min", "-max", "-add_delay",
+       "-network_latency_included", "-source_latency_included"},
+      {"-clock", "-reference_pin"},
+      {"delay_value", "port_pin_list"}
+    }},
+    {"set_output_delay", {
+      {"-clock_fall", "-level_sensitive", "-rise", "-fall", "-min", "-max", "-add_delay",
+       "-network_latency_included", "-source_latency_included"},
+      {"-clock", "-reference_pin"},
+      {"delay_value", "port_pin_list"}
+    }},
+    {"set_input_transition", {
+      {"-rise", "-fall", "-min", "-max", "-clock_fall"},
+      {"-clock"},
+      {"transition", "port_list"}
+    }},
+    {"set_load", {
+      {"-min", "-max", "-substract_pin_load", "-pin_load", "-wire_load"},
+      {},
+      {"value", "objects"}
+    }}
+  };
+
+  if(auto itr = syntaxes.find(command); itr != syntaxes.end()) {
+    return &(itr->second);
+  }
+  return nullptr;
+}
+
+// Function: evaluate_object
+// Evaluate a nested object query the same way as the callback of sdc.tcl.
+std::optional<std::string> evaluate_object(const std::vector<std::string>& words) {
+
+  if(words.empty()) {
+    return std::nullopt;
+  }
+
+  const auto& cmd = words[0];
+
+  // port and clock patterns are bare; other queries keep their command (see parse_port)
+  std::string query;
+
+  if(cmd == "get_ports" || cmd == "get_port") {
+    query = "get_ports";
+  }
+  else if(cmd == "get_pins" || cmd == "get_pin") {
+    query = "get_pins";
+  }
+  else if(cmd == "get_cells" || cmd == "get_cell") {
+    query = "get_cells";
+  }
+  else if(cmd == "get_nets" || cmd == "get_net") {
+    query = "get_nets";
+  }
+  else if(cmd == "get_clocks" || cmd == "get_clock") {
+    query = "get_clocks";
+  }
+
+  if(!query.empty()) {
+    std::optional<std::string> patterns;
+    bool regexp {false};
+    for(size_t i=1; i<words.size(); ++i) {
+      if(words[i] == "-hierarchical") {
+        continue;
+      }
+      if(words[i] == "-regexp") {
+        regexp = (query != "get_clocks");
+        continue;
+      }
+      if(patterns) {
+        return std::nullopt;
+      }
+      patterns = words[i];
+    }
+    if(patterns && regexp) {
+      patterns = query + " -regexp " + *patterns;
+    }
+    else if(patterns && query != "get_ports" && query != "get_clocks") {
+      patterns = query + " " + *patterns;
+    }
+    return patterns;
+  }
+
+  if(words.size() == 1 && (cmd == "all_inputs" || cmd == "all_outputs" || cmd == "all_clocks")) {
+    return cmd;
+  }
+
+  return std::nullopt;
+}
+
+// Function: split_command
+// Split the next command of a script into words starting at position i. Braced words are
+// literal, quoted and bare words must be free of substitutions, and a bracketed word is a
+// nested object query. Returns false on any construct outside the subset.
+bool split_command(std::string_view text, size_t& i, bool nested, std::vector<std::string>& words) {
+
+  const size_t N = text.size();
+
+  auto is_space = [] (char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+  };
+
+  auto is_end = [&] (size_t j) {
+    return j >= N || is_space(text[j]) || text[j] == '\n' || text[j] == ';' ||
+           (nested && text[j] == ']');
+  };
+
+  while(i < N) {
+
+    // white spaces and line continuations
+    if(is_space(text[i])) {
+      ++i;
+      continue;
+    }
+
+    if(text[i] == '\\') {
+      if(i + 1 < N && text[i+1] == '\n') {
+        i += 2;
+        continue;
+      }
+      return false;
+    }
+
+    // end of the command
+    if(text[i] == '\n' || text[i] == ';') {
+      if(nested) {
+        return false;
+      }
+      ++i;
+      if(!words.empty()) {
+        return true;
+      }
+      continue;
+    }
+
+    if(text[i] == ']') {
+      if(!nested) {
+        return false;
+      }
+      ++i;
+      return true;
+    }
+
+    // comment
+    if(text[i] == '#' && words.empty()) {
+      while(i < N && text[i] != '\n') {
+        ++i;
+      }
+      continue;
+    }
+
+    std::string word;
+
+    // {literal}
+    if(text[i] == '{') {
+      size_t depth {1}, j {i+1};
+      for(; j < N && depth; ++j) {
+        if(text[j] == '{') ++depth;
+        else if(text[j] == '}') --depth;
+      }
+      if(depth) {
+        return false;
+      }
+      word.assign(text.substr(i+1, j-i-2));
+      i = j;
+    }
+    // "quoted"
+    else if(text[i] == '"') {
+      auto j = text.find('"', i+1);
+      if(j == std::string_view::npos) {
+        return false;
+      }
+      word.assign(text.substr(i+1, j-i-1));
+      if(word.find_first_of("$[\\") != std::string::npos) {
+        return false;
+      }
+      i = j + 1;
+    }
+    // [nested command]
+    else if(text[i] == '[') {
+      std::vector<std::string> sub;
+      if(!split_command(text, ++i, true, sub)) {
+        return false;
+      }
+      if(auto value = evaluate_object(sub); value) {
+        word = std::move(*value);
+      }
+      else {
+        return false;
+      }
+    }
+    // bare word
+    else {
+      auto j = i;
+      while(!is_end(j)) {
+        ++j;
+      }
+      word.assign(text.substr(i, j-i));
+      if(word.find_first_of("$[{}\"\\") != std::string::npos) {
+        return false;
+      }
+      i = j;
+    }
+
+    // words cannot be concatenated (e.g., {a}b or [get_ports a]b)
+    if(!is_end(i)) {
+      return false;
+    }
+
+    words.push_back(std::move(word));
+  }
+
+  return !nested;
+}
+
+// Function: parse
+// Parse the SDC subset understood by OpenTimer in process. The result is the same json as
+// the one produced by sdc.tcl. A script with any other command or Tcl construct (variables,
+// expressions, control flow) yields std::nullopt and is left to tclsh.
+std::optional<Json> parse(std::string_view text) {
+
+  Json json = Json::array();
+
+  std::vector<std::string> words;
+
+  for(size_t i=0; i<text.size(); ) {
+
+    words.clear();
+
+    if(!split_command(text, i, false, words)) {
+      return std::nullopt;
+    }
+
+    if(words.empty()) {
+      continue;
+    }
+
+    auto s = find_syntax(words[0]);
+
+    if(s == nullptr) {
+      return std::nullopt;
+    }
+
+    Json j;
+    j["command"] = words[0];
+
+    size_t p {0};
+
+    for(size_t w=1; w<words.size(); ++w) {
+      const auto& word = words[w];
+      if(std::find(s->flags.begin(), s->flags.end(), word) != s->flags.end()) {
+        j[word] = "yes";
+      }
+      else if(std::find(s->options.begin(), s->options.end(), word) != s->options.end()) {
+        if(++w == words.size()) {
+          return std::nullopt;
+        }
+        j[word] = words[w];
+      }
+      else if(word.size() > 1 && word[0] == '-' && !is_numeric(word)) {
+        return std::nullopt;
+      }
+      else if(p < s->positionals.size()) {
+        j[std::string(s->positionals[p++])] = word;
+      }
+      else {
+        return std::nullopt;
+      }
+    }
+
+    // commands with missing parameters are rejected as in sdc.tcl
+    bool valid = (words[0] == "create_clock") ?
+      j.count("-period") && (j.count("-name") || j.count("port_pin_list")) :
+      p == s->positionals.size();
+
+    if(!valid) {
+      OT_LOGE("sdc ", words[0], ": missing required arguments");
+      continue;
+    }
+
+    json.push_back(std::move(j));
+  }
+
+  return json;
+}
+
+};  // end of namespace ot::sdc. ------------------------------------------------------------------
@@ -21,10 +21,27 @@ std::filesystem::path home() {
 }
 
 // Procedure: read
+// Read the supported subset of SDC in process and fall back to tclsh for everything else.
 void SDC::read(const std::filesystem::path& path) {
 
   OT_LOGE_RIF(!std::filesystem::exists(path), "sdc ", path, " doesn't exist");
 
+  if(MappedFile file(path); file.is_open()) {
+    if(auto json = parse(file.view()); json) {
+      OT_LOGI("loading sdc ", path, " ...");
+      _read(*json);
+      return;
+    }
+    OT_LOGI("sdc ", path, " is beyond the native subset; falling back to tclsh");
+  }
+
+  _read_tcl(path);
+}
+
+// Procedure: _read_tcl
+// Evaluate the sdc with tclsh in a child process that writes the commands to a json file.
+void SDC::_read_tcl(const std::filesystem::path& path) {
+
   auto sdc_home = home();
 
   OT_LOGE_RIF(
@@ -90,27 +107,7 @@ void SDC::read(const std::filesystem::path& path) {
     Json json;
     ifs >> json;
 
-    for(const auto& j : json) {
-
-      if(const auto& c = j["command"]; c == "set_input_delay") {
-        commands.emplace_back(std::in_place_type_t<SetInputDelay>{}, j);  
-      }
-      else if(c == "set_input_transition") {
-        commands.emplace_back(std::in_place_type_t<SetInputTransition>{}, j);
-      }
-      else if(c == "set_output_delay") {
-        commands.emplace_back(std::in_place_type_t<SetOutputDelay>{}, j);
-      }
-      else if(c == "set_load") {
-        commands.emplace_back(std::in_place_type_t<SetLoad>{}, j);
-      }
-      else if(c == "create_clock") {
-        commands.emplace_back(std::in_place_type_t<CreateClock>{}, j);
-      }
-      else {
-        OT_LOGE("sdc command ", c, " not supported yet");
-      }
-    }
+    _read(json);
 
     try {
       std::filesystem::remove(sdc_json);
@@ -121,6 +118,33 @@ void SDC::read(const std::filesystem::path& path) {
   }
 }
 
+// Procedure: _read
+// Build the commands from the json array of command objects.
+void SDC::_read(const Json& json) {
+
+  for(const auto& j : json) {
+
+    if(const auto& c = j["command"]; c == "set_input_delay") {
+      commands.emplace_back(std::in_place_type_t<SetInputDelay>{}, j);  
+    }
+    else if(c == "set_input_transition") {
+      commands.emplace_back(std::in_place_type_t<SetInputTransition>{}, j);
+    }
+    else if(c == "set_output_delay") {
+      commands.emplace_back(std::in_place_type_t<SetOutputDelay>{}, j);
+    }
+    else if(c == "set_load") {
+      commands.emplace_back(std::in_place_type_t<SetLoad>{}, j);
+    }
+    else if(c == "create_clock") {
+      commands.emplace_back(std::in_place_type_t<CreateClock>{}, j);
+    }
+    else {
+      OT_LOGE("sdc command ", c, " not supported yet");
+    }
+  }
+}
+
 // ------------------------------------------------------------------------------------------------
 
 // Constructor
@@ -9,6 +9,9 @@ namespace ot::sdc {
 // Function: home
 std::filesystem::path home();
 
+// Function: parse
+std::optional<Json> parse(std::string_view);
+
 // SetInputDelay
 struct SetInputDelay {
 
@@ -141,8 +144,15 @@ using Command = std::variant<
 
 // Class: SDC
 struct SDC {
+
   std::vector<Command> commands;
+
   void read(const std::filesystem::path&);
+
+  private:
+
+    void _read(const Json&);
+    void _read_tcl(const std::filesystem::path&);
 };
 
 };  // end of namespace ot::sdc. ------------------------------------------------------------------
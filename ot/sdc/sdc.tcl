@@ -51,11 +51,31 @@ proc sdc_callback {cmd parsing_result} {
       return ""
     }
 
-    get_clocks -
+    get_clocks {
+      return [join $res(patterns) " "]
+    }
+
+    get_port -
     get_ports {
+      if {[info exists res(-regexp)]} {
+        return "get_ports -regexp [join $res(patterns) " "]"
+      }
       return [join $res(patterns) " "]
     }
 
+    get_pin -
+    get_pins -
+    get_cell -
+    get_cells -
+    get_net -
+    get_nets {
+      set query [string trimright $cmd "s"]s
+      if {[info exists res(-regexp)]} {
+        return "$query -regexp [join $res(patterns) " "]"
+      }
+      return "$query [join $res(patterns) " "]"
+    }
+
     all_inputs {
       return "all_inputs"
     }
@@ -4,7 +4,41 @@ namespace ot {
 
 // Procedure: update_timing
 void Shell::_update_timing() {
-  _timer.update_timing();
+
+  std::string token;
+  bool exact {false};
+
+  while(_is >> token) {
+    if(token == "-exact") {
+      exact = true;
+    }
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  _timer.update_timing(exact);
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: report_approximate_pins
+void Shell::_report_approximate_pins() {
+  for(const auto& pin : _timer.report_approximate_pins()) {
+    _os << pin << '\n';
+  }
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: save_checkpoint
+void Shell::_save_checkpoint() {
+  if(std::filesystem::path path; _is >> path) {
+    _timer.save_checkpoint(path);
+  }
+  else {
+    _es << "checkpoint file not given\n";
+  }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -211,6 +245,40 @@ void Shell::_report_fep() {
   }
 }
 
+// Procedure: size_gates
+void Shell::_size_gates() {
+
+  std::string token;
+  size_t iterations {10};
+
+  while(_is >> token) {
+    if(token == "-iterations") {
+      if(!(_is >> iterations)) {
+        _es << "failed to parse the number of iterations\n";
+        return;
+      }
+    }
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  auto result = _timer.size_gates(iterations);
+
+  _os << "sized " << result.num_moves << " gates in " << result.num_iterations
+      << " iterations\n"
+      << "tns before: " << result.tns_before.value_or(0.0f) << '\n'
+      << "tns after : " << result.tns_after.value_or(0.0f) << '\n';
+}
+
+// Procedure: report_lut_stats
+void Shell::_report_lut_stats() {
+  auto stats = _timer.report_lut_stats();
+  _os << "lut hits  : " << stats.num_hits << '\n'
+      << "lut misses: " << stats.num_misses << '\n'
+      << "hit rate  : " << stats.hit_rate() << '\n';
+}
+
 // ------------------------------------------------------------------------------------------------
 
 // Procedure: report_timing
@@ -315,6 +383,159 @@ void Shell::_report_leakage_power() {
   }
 }
 
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: report_power
+void Shell::_report_power() {
+
+  std::string token;
+  std::string gate;
+  std::string net;
+
+  while(_is >> token) {
+    if(token == "-gate") _is >> gate;
+    else if(token == "-net") _is >> net;
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  auto power = !gate.empty() ? _timer.report_gate_power(gate) :
+               !net.empty()  ? _timer.report_net_power(net) : _timer.report_power();
+
+  if(power) {
+    _os << "switching: " << power->switching << '\n'
+        << "internal : " << power->internal  << '\n'
+        << "leakage  : " << power->leakage   << '\n'
+        << "total    : " << power->total()   << '\n';
+  }
+  else {
+    _os << std::numeric_limits<float>::quiet_NaN() << '\n';
+  }
+}
+
+// Procedure: report_switching_activity
+void Shell::_report_switching_activity() {
+
+  std::string token;
+  std::string pin;
+
+  while(_is >> token) {
+    if(token == "-pin") _is >> pin;
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  if(pin.empty()) {
+    _es << "-pin <name> not given\n";
+    return;
+  }
+
+  if(auto activity = _timer.report_switching_activity(pin); activity) {
+    _os << activity->toggle_rate << ' ' << activity->static_probability << '\n';
+  }
+  else {
+    _os << std::numeric_limits<float>::quiet_NaN() << '\n';
+  }
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: report_equivalent_cells
+void Shell::_report_equivalent_cells() {
+
+  std::string token;
+  std::string cell;
+  auto el = MIN;
+  bool by_drive {false};
+
+  while(_is >> token) {
+    if(token == "-cell") _is >> cell;
+    else if(token == "-min" || token == "-early") el = MIN;
+    else if(token == "-max" || token == "-late" ) el = MAX;
+    else if(token == "-area" ) by_drive = false;
+    else if(token == "-drive") by_drive = true;
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  if(cell.empty()) {
+    _es << "-cell <name> not given\n";
+    return;
+  }
+
+  if(auto fp = _timer.report_equivalent_cells(cell, el); fp) {
+    for(const auto c : (by_drive ? fp->by_drive : fp->by_area)) {
+      _os << c->name << '\n';
+    }
+  }
+  else {
+    _os << "no equivalent cell found\n";
+  }
+}
+
+// Procedure: _get_objects
+// Parse "[-regexp] <pattern>..." and print the names found by the given timer query.
+template <typename F>
+void _get_objects(std::istream& is, std::ostream& os, std::ostream& es, F&& find) {
+
+  std::string token;
+  std::vector<std::string> patterns;
+  bool regexp {false};
+
+  while(is >> token) {
+    if(token == "-regexp") regexp = true;
+    else if(token == "-hierarchical") continue;
+    else patterns.push_back(token);
+  }
+
+  if(patterns.empty()) {
+    es << "<pattern> not given\n";
+    return;
+  }
+
+  for(const auto& pattern : patterns) {
+    if(auto names = find(pattern, regexp); names.empty()) {
+      es << "no object matches " << std::quoted(pattern) << '\n';
+    }
+    else {
+      for(const auto& name : names) {
+        os << name << '\n';
+      }
+    }
+  }
+}
+
+// Procedure: get_pins
+void Shell::_get_pins() {
+  _get_objects(_is, _os, _es, [this] (const std::string& p, bool r) {
+    return _timer.find_pins(p, r);
+  });
+}
+
+// Procedure: get_ports
+void Shell::_get_ports() {
+  _get_objects(_is, _os, _es, [this] (const std::string& p, bool r) {
+    return _timer.find_ports(p, r);
+  });
+}
+
+// Procedure: get_cells
+void Shell::_get_cells() {
+  _get_objects(_is, _os, _es, [this] (const std::string& p, bool r) {
+    return _timer.find_gates(p, r);
+  });
+}
+
+// Procedure: get_nets
+void Shell::_get_nets() {
+  _get_objects(_is, _os, _es, [this] (const std::string& p, bool r) {
+    return _timer.find_nets(p, r);
+  });
+}
+
 };  // end of namespace ot. -----------------------------------------------------------------------
 
 
@@ -90,9 +90,21 @@ void Shell::_read_verilog() {
 
 // Procedure: read_spef
 void Shell::_read_spef() {
-  if(std::filesystem::path path; _is >> path) {
-    _timer.read_spef(std::move(path));
+
+  std::string token;
+  std::filesystem::path path;
+  bool stream {false};
+
+  while(_is >> token) {
+    if(token == "-stream") {
+      stream = true;
+    }
+    else {
+      path = std::move(token);
+    }
   }
+
+  _timer.read_spef(std::move(path), stream);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -106,6 +118,15 @@ void Shell::_read_timing() {
 
 // ------------------------------------------------------------------------------------------------
 
+// Procedure: load_checkpoint
+void Shell::_load_checkpoint() {
+  if(std::filesystem::path path; _is >> path) {
+    _timer.load_checkpoint(std::move(path));
+  }
+}
+
+// ------------------------------------------------------------------------------------------------
+
 // Procedure: read_celllib
 void Shell::_read_celllib() {
 
@@ -364,6 +385,39 @@ void Shell::_connect_pin() {
 
 // ------------------------------------------------------------------------------------------------
 
+// Procedure: insert_buffer
+void Shell::_insert_buffer() {
+
+  if(std::string gate, cell, net, buffered_net; (_is >> gate >> cell >> net >> buffered_net)) {
+    
+    std::vector<std::string> sinks;
+    
+    for(std::string sink; _is >> sink;) {
+      sinks.push_back(std::move(sink));
+    }
+
+    _timer.insert_buffer(
+      std::move(net), std::move(sinks), std::move(cell), std::move(gate), std::move(buffered_net)
+    );
+  }
+  else {
+    _es << "usage: insert_buffer <gate> <cell> <net> <buffered_net> <sink>...\n";
+  }
+}
+
+// Procedure: remove_buffer
+void Shell::_remove_buffer() {
+
+  if(std::string gate; _is >> gate) {
+    _timer.remove_buffer(std::move(gate));
+  }
+  else {
+    _es << "usage: remove_buffer <gate>\n";
+  }
+}
+
+// ------------------------------------------------------------------------------------------------
+
 // Procedure: cppr
 void Shell::_cppr() {
 
@@ -390,6 +444,109 @@ void Shell::_disable_cppr() {
   _timer.cppr(false);
 }
 
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: power_analysis
+void Shell::_power_analysis() {
+
+  std::string token;
+
+  if(_is >> token; token == "-disable") {
+    _timer.power_analysis(false);
+  }
+  else if(token == "-enable") {
+    _timer.power_analysis(true);
+  }
+  else {
+    _es << "usage: power_analysis -disable|-enable\n";
+  }
+}
+
+// Procedure: set_switching_activity
+void Shell::_set_switching_activity() {
+
+  std::string token;
+  std::string pin;
+  bool is_default {false};
+  std::vector<float> values;
+
+  while(_is >> token) {
+    if(token == "-pin") _is >> pin;
+    else if(token == "-default") is_default = true;
+    else {
+      try {
+        values.push_back(std::stof(token));
+      }
+      catch(...) {
+        _es << "failed to parse " << std::quoted(token) << '\n';
+        return;
+      }
+    }
+  }
+
+  if(pin.empty() && !is_default) {
+    _es << "-pin <name> or -default not given\n";
+    return;
+  }
+
+  std::optional<Activity> activity;
+
+  if(!values.empty()) {
+    activity = Activity {values[0], values.size() > 1 ? values[1] : 0.5f};
+  }
+
+  if(is_default) {
+    _timer.set_default_switching_activity(activity);
+  }
+  else {
+    _timer.set_switching_activity(std::move(pin), activity);
+  }
+}
+
+// Procedure: _set_approximate_update
+void Shell::_set_approximate_update() {
+
+  std::string token;
+  std::optional<size_t> depth;
+  std::optional<float> threshold;
+
+  while(_is >> token) {
+    if(token == "-depth") {
+      if(size_t k; _is >> k) {
+        depth = k;
+      }
+      else {
+        _es << "failed to parse the depth\n";
+        return;
+      }
+    }
+    else if(token == "-threshold") {
+      if(float v; _is >> v) {
+        threshold = v;
+      }
+      else {
+        _es << "failed to parse the threshold\n";
+        return;
+      }
+    }
+    else {
+      _es << "failed to parse " << std::quoted(token) << '\n';
+    }
+  }
+
+  _timer.set_approximate_update(depth, threshold);
+}
+
+// Procedure: _set_lut_tolerance
+void Shell::_set_lut_tolerance() {
+  if(float tolerance; _is >> tolerance) {
+    _timer.set_lut_tolerance(tolerance);
+  }
+  else {
+    _es << "failed to parse the tolerance\n";
+  }
+}
+
 
 };  // end of namespace ot. -----------------------------------------------------------------------
 
@@ -52,9 +52,10 @@ List of commonly used commands:\n\
   set_num_threads    <N>\n\
   read_celllib       [-min|-max] <file>\n\
   read_verilog       <file>\n\
-  read_spef          <file>\n\
+  read_spef          [-stream] <file>\n\
   read_sdc           <file>\n\
   read_timing        <file>\n\
+  load_checkpoint    <file>\n\
   set_slew           -pin name [-min|-max] [-rise|-fall] <value>\n\
   set_at             -pin name [-min|-max] [-rise|-fall] <value>\n\
   set_rat            -pin name [-min|-max] [-rise|-fall] <value>\n\
@@ -66,9 +67,17 @@ List of commonly used commands:\n\
   remove_net         <net>\n\
   disconnect_pin     <pin>\n\
   connect_pin        <pin> <net>\n\
+  insert_buffer      <gate> <cell> <net> <buffered_net> <sink>...\n\
+  remove_buffer      <gate>\n\
   cppr               -disable|-enable\n\
+  power_analysis     -disable|-enable\n\
+  set_switching_activity -pin name|-default [<toggle_rate> [<static_probability>]]\n\
+  set_approximate_update [-depth <K>] [-threshold <value>]\n\
+  set_lut_tolerance  <value>\n\
 \n[Action] operations to update the timer\n\n\
-  update_timing\n\
+  update_timing      [-exact]\n\
+  report_approximate_pins\n\
+  save_checkpoint    <file>\n\
   report_timing\n\
   report_path        [-num_paths <N>]\n\
   report_slew        -pin name [-min|-max] [-rise|-fall]\n\
@@ -78,6 +87,10 @@ List of commonly used commands:\n\
   report_wns\n\
   report_tns\n\
   report_fep\n\
+  report_power       [-gate name|-net name]\n\
+  report_switching_activity -pin name\n\
+  size_gates         [-iterations <N>]\n\
+  report_lut_stats\n\
 \n[Dump] operations to inspect the timer\n\n\
   help\n\
   version\n\
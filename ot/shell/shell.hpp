@@ -50,6 +50,7 @@ class Shell {
     void _read_celllib           ();
     void _read_sdc               ();
     void _read_timing            ();
+    void _load_checkpoint        ();
     void _set_at                 (); 
     void _set_slew               ();
     void _set_load               ();
@@ -60,13 +61,21 @@ class Shell {
     void _insert_net             ();
     void _remove_net             ();
     void _disconnect_pin         ();
+    void _insert_buffer          ();
+    void _remove_buffer          ();
     void _connect_pin            ();
     void _cppr                   ();
     void _enable_cppr            ();
     void _disable_cppr           ();
+    void _power_analysis         ();
+    void _set_switching_activity ();
+    void _set_approximate_update ();
+    void _set_lut_tolerance      ();
 
     // action
     void _update_timing          ();
+    void _report_approximate_pins();
+    void _save_checkpoint        ();
     void _report_timing          ();
     void _report_path            ();
     void _report_at              ();
@@ -78,6 +87,15 @@ class Shell {
     void _report_fep             ();
     void _report_area            ();
     void _report_leakage_power   ();
+    void _report_power           ();
+    void _report_switching_activity();
+    void _report_equivalent_cells();
+    void _size_gates             ();
+    void _report_lut_stats       ();
+    void _get_pins               ();
+    void _get_ports              ();
+    void _get_cells              ();
+    void _get_nets               ();
 
     // Dump
     void _dump_version           ();
@@ -129,6 +147,7 @@ class Shell {
       {"read_celllib",            &Shell::_read_celllib},
       {"read_sdc",                &Shell::_read_sdc},
       {"read_timing",             &Shell::_read_timing},
+      {"load_checkpoint",         &Shell::_load_checkpoint},
       {"set_at",                  &Shell::_set_at},
       {"set_slew",                &Shell::_set_slew},
       {"set_load",                &Shell::_set_load},
@@ -139,13 +158,21 @@ class Shell {
       {"insert_net",              &Shell::_insert_net},
       {"remove_net",              &Shell::_remove_net},
       {"disconnect_pin",          &Shell::_disconnect_pin},
+      {"insert_buffer",           &Shell::_insert_buffer},
+      {"remove_buffer",           &Shell::_remove_buffer},
       {"connect_pin",             &Shell::_connect_pin},
       {"cppr",                    &Shell::_cppr},
       {"enable_cppr",             &Shell::_enable_cppr},
       {"disable_cppr",            &Shell::_disable_cppr},
+      {"power_analysis",          &Shell::_power_analysis},
+      {"set_switching_activity",  &Shell::_set_switching_activity},
+      {"set_approximate_update",  &Shell::_set_approximate_update},
+      {"set_lut_tolerance",       &Shell::_set_lut_tolerance},
 
       // Action
       {"update_timing",           &Shell::_update_timing},
+      {"report_approximate_pins", &Shell::_report_approximate_pins},
+      {"save_checkpoint",         &Shell::_save_checkpoint},
       {"report_timing",           &Shell::_report_timing},
       {"report_path",             &Shell::_report_path},
       {"report_at",               &Shell::_report_at},
@@ -157,6 +184,15 @@ class Shell {
       {"report_fep",              &Shell::_report_fep},
       {"report_area",             &Shell::_report_area},
       {"report_leakage_power",    &Shell::_report_leakage_power},
+      {"report_power",            &Shell::_report_power},
+      {"report_switching_activity", &Shell::_report_switching_activity},
+      {"report_equivalent_cells", &Shell::_report_equivalent_cells},
+      {"size_gates",              &Shell::_size_gates},
+      {"report_lut_stats",        &Shell::_report_lut_stats},
+      {"get_pins",                &Shell::_get_pins},
+      {"get_ports",               &Shell::_get_ports},
+      {"get_cells",               &Shell::_get_cells},
+      {"get_nets",                &Shell::_get_nets},
 
       // Dump
       {"help",                    &Shell::_dump_help},
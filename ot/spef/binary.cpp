@@ -0,0 +1,326 @@
+#include <ot/spef/binary.hpp>
+#include <ot/static/logger.hpp>
+
+namespace ot {
+
+// the byte order mark of the machine that wrote the file
+constexpr uint32_t BINARY_SPEF_BYTE_ORDER = 0x01020304;
+
+// Function: is_binary
+// Check whether the file starts with the magic number of the binary format.
+bool BinarySpef::is_binary(const std::filesystem::path& path) {
+  std::ifstream ifs(path, std::ios::binary);
+  char magic[sizeof(MAGIC)];
+  return ifs.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+// Function: write
+// Write the nets of a spef to the binary format. The names of the spef must have been
+// resolved from the name map (see spef::Spef::expand_name and spef::Spef::localize_name).
+bool BinarySpef::write(const spef::Spef& spef, const std::filesystem::path& path) {
+
+  std::ofstream ofs(path, std::ios::binary);
+
+  if(!ofs.good()) {
+    return false;
+  }
+
+  // intern all names
+  std::vector<std::string_view> strings;
+  std::unordered_map<std::string_view, uint32_t> ids;
+
+  auto intern = [&] (std::string_view s) {
+    if(auto [itr, ok] = ids.try_emplace(s, strings.size()); ok) {
+      strings.push_back(s);
+      return itr->second;
+    }
+    else {
+      return itr->second;
+    }
+  };
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version          = VERSION;
+  header.byte_order       = BINARY_SPEF_BYTE_ORDER;
+  header.design_name      = intern(spef.design_name);
+  header.time_unit        = intern(spef.time_unit);
+  header.capacitance_unit = intern(spef.capacitance_unit);
+  header.resistance_unit  = intern(spef.resistance_unit);
+  header.inductance_unit  = intern(spef.inductance_unit);
+  header.divider          = intern(spef.divider);
+  header.delimiter        = intern(spef.delimiter);
+  header.bus_delimiter    = intern(spef.bus_delimiter);
+
+  std::vector<Index> index(spef.nets.size());
+  uint64_t bytes {0};
+
+  for(size_t i=0; i<spef.nets.size(); ++i) {
+    const auto& net = spef.nets[i];
+    index[i].name = intern(net.name);
+    index[i].padding = 0;
+    index[i].offset = bytes;
+    for(const auto& c : net.connections) {
+      intern(c.name);
+      intern(c.driving_cell);
+    }
+    for(const auto& [node1, node2, cap] : net.caps) {
+      intern(node1);
+      intern(node2);
+    }
+    for(const auto& [node1, node2, res] : net.ress) {
+      intern(node1);
+      intern(node2);
+    }
+    bytes += sizeof(Net) +
+             sizeof(Connection) * net.connections.size() +
+             sizeof(Element) * (net.caps.size() + net.ress.size());
+  }
+
+  // string table
+  std::vector<uint64_t> offsets(strings.size() + 1, 0);
+  for(size_t i=0; i<strings.size(); ++i) {
+    offsets[i+1] = offsets[i] + strings[i].size() + 1;
+  }
+
+  auto align = [] (uint64_t n) { return (n + 7) & ~uint64_t{7}; };
+
+  header.num_strings = strings.size();
+  header.strings     = sizeof(Header);
+  header.chars       = header.strings + sizeof(uint64_t) * offsets.size();
+  header.num_nets    = index.size();
+  header.index       = align(header.chars + offsets.back());
+
+  const uint64_t records = header.index + sizeof(Index) * index.size();
+
+  for(auto& entry : index) {
+    entry.offset += records;
+  }
+
+  std::sort(index.begin(), index.end(), [&] (const Index& a, const Index& b) {
+    return strings[a.name] < strings[b.name];
+  });
+
+  auto put = [&ofs] (const auto& v) {
+    ofs.write(reinterpret_cast<const char*>(&v), sizeof(v));
+  };
+
+  put(header);
+
+  ofs.write(reinterpret_cast<const char*>(offsets.data()), sizeof(uint64_t) * offsets.size());
+
+  for(const auto& s : strings) {
+    ofs.write(s.data(), s.size()).put('\0');
+  }
+
+  for(auto n = header.chars + offsets.back(); n < header.index; ++n) {
+    ofs.put('\0');
+  }
+
+  ofs.write(reinterpret_cast<const char*>(index.data()), sizeof(Index) * index.size());
+
+  // net records in the order of the spef
+  for(const auto& net : spef.nets) {
+
+    put(Net{
+      ids[net.name],
+      net.lcap,
+      static_cast<uint32_t>(net.connections.size()),
+      static_cast<uint32_t>(net.caps.size()),
+      static_cast<uint32_t>(net.ress.size())
+    });
+
+    for(const auto& c : net.connections) {
+      put(Connection{
+        ids[c.name],
+        ids[c.driving_cell],
+        static_cast<uint8_t>(c.type),
+        static_cast<uint8_t>(c.direction),
+        static_cast<uint8_t>(c.load.has_value()),
+        static_cast<uint8_t>(c.coordinate.has_value()),
+        c.load.value_or(0.0f),
+        c.coordinate ? c.coordinate->first : 0.0f,
+        c.coordinate ? c.coordinate->second : 0.0f
+      });
+    }
+
+    for(const auto& [node1, node2, cap] : net.caps) {
+      put(Element{ids[node1], ids[node2], cap});
+    }
+
+    for(const auto& [node1, node2, res] : net.ress) {
+      put(Element{ids[node1], ids[node2], res});
+    }
+  }
+
+  return ofs.good();
+}
+
+// Function: open
+// Map a binary spef into memory and validate its header, string table and net index.
+bool BinarySpef::open(const std::filesystem::path& path) {
+
+  _header  = nullptr;
+  _strings = nullptr;
+  _index   = nullptr;
+
+  if(!_file.open(path)) {
+    return false;
+  }
+
+  const auto size = _file.size();
+  const auto data = _file.data();
+  const auto header = reinterpret_cast<const Header*>(data);
+
+  if(size < sizeof(Header) ||
+     std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+     header->version != VERSION ||
+     header->byte_order != BINARY_SPEF_BYTE_ORDER ||
+     header->strings % alignof(uint64_t) || header->index % alignof(Index) ||
+     header->strings + sizeof(uint64_t) * (header->num_strings + 1) > size ||
+     header->index + sizeof(Index) * header->num_nets > size) {
+    _file.close();
+    return false;
+  }
+
+  auto strings = reinterpret_cast<const uint64_t*>(data + header->strings);
+
+  auto valid = [n=header->num_strings] (uint32_t id) { return id < n; };
+
+  if(header->chars + strings[header->num_strings] > size ||
+     !valid(header->design_name) || !valid(header->time_unit) ||
+     !valid(header->capacitance_unit) || !valid(header->resistance_unit) ||
+     !valid(header->inductance_unit) || !valid(header->divider) ||
+     !valid(header->delimiter) || !valid(header->bus_delimiter)) {
+    _file.close();
+    return false;
+  }
+
+  _header  = header;
+  _strings = strings;
+  _index   = reinterpret_cast<const Index*>(data + header->index);
+
+  return true;
+}
+
+// Procedure: read_header
+// Copy the design name, units and delimiters to a spef.
+void BinarySpef::read_header(spef::Spef& spef) const {
+  spef.design_name      = _string(_header->design_name);
+  spef.time_unit        = _string(_header->time_unit);
+  spef.capacitance_unit = _string(_header->capacitance_unit);
+  spef.resistance_unit  = _string(_header->resistance_unit);
+  spef.inductance_unit  = _string(_header->inductance_unit);
+  spef.divider          = _string(_header->divider);
+  spef.delimiter        = _string(_header->delimiter);
+  spef.bus_delimiter    = _string(_header->bus_delimiter);
+}
+
+// Procedure: read
+// Decode the header and all nets to a spef.
+void BinarySpef::read(spef::Spef& spef) const {
+
+  read_header(spef);
+
+  spef.nets.reserve(spef.nets.size() + num_nets());
+
+  for(size_t i=0; i<num_nets(); ++i) {
+    spef.nets.push_back(net(i));
+  }
+}
+
+// Function: net
+// Decode the i-th net in the index (sorted by name).
+spef::Net BinarySpef::net(size_t i) const {
+
+  assert(i < num_nets());
+
+  const auto size = _file.size();
+  const auto base = _file.data() + _index[i].offset;
+  const auto rec  = reinterpret_cast<const Net*>(base);
+
+  spef::Net net;
+
+  if(_index[i].offset + sizeof(Net) > size ||
+     _index[i].offset + sizeof(Net) + sizeof(Connection) * rec->num_connections +
+     sizeof(Element) * (uint64_t{rec->num_caps} + rec->num_ress) > size) {
+    OT_LOGE("corrupted binary spef net record ", i);
+    return net;
+  }
+
+  auto valid = [n=_header->num_strings] (uint32_t id) { return id < n; };
+
+  if(!valid(rec->name)) {
+    OT_LOGE("corrupted binary spef net record ", i);
+    return net;
+  }
+
+  auto conns = reinterpret_cast<const Connection*>(base + sizeof(Net));
+  auto elems = reinterpret_cast<const Element*>(conns + rec->num_connections);
+
+  net.name = _string(rec->name);
+  net.lcap = rec->lcap;
+
+  net.connections.resize(rec->num_connections);
+
+  for(size_t c=0; c<rec->num_connections; ++c) {
+    const auto& from = conns[c];
+    auto& to = net.connections[c];
+    if(!valid(from.name) || !valid(from.driving_cell)) {
+      OT_LOGE("corrupted binary spef net record ", i);
+      return spef::Net{};
+    }
+    to.name         = _string(from.name);
+    to.driving_cell = _string(from.driving_cell);
+    to.type         = static_cast<spef::ConnectionType>(from.type);
+    to.direction    = static_cast<spef::ConnectionDirection>(from.direction);
+    if(from.has_load) {
+      to.load = from.load;
+    }
+    if(from.has_coordinate) {
+      to.coordinate.emplace(from.x, from.y);
+    }
+  }
+
+  auto decode = [&] (auto& elements, const Element* from, size_t n) {
+    elements.reserve(n);
+    for(size_t e=0; e<n; ++e) {
+      if(!valid(from[e].node1) || !valid(from[e].node2)) {
+        return false;
+      }
+      elements.emplace_back(
+        std::string(_string(from[e].node1)), std::string(_string(from[e].node2)), from[e].value
+      );
+    }
+    return true;
+  };
+
+  if(!decode(net.caps, elems, rec->num_caps) ||
+     !decode(net.ress, elems + rec->num_caps, rec->num_ress)) {
+    OT_LOGE("corrupted binary spef net record ", i);
+    return spef::Net{};
+  }
+
+  return net;
+}
+
+// Function: net
+// Look up a net by name through the index and decode only that net.
+std::optional<spef::Net> BinarySpef::net(std::string_view name) const {
+
+  auto beg = _index;
+  auto end = _index + num_nets();
+
+  auto itr = std::lower_bound(beg, end, name, [this] (const Index& entry, std::string_view key) {
+    return _string(entry.name) < key;
+  });
+
+  if(itr == end || _string(itr->name) != name) {
+    return std::nullopt;
+  }
+
+  return net(static_cast<size_t>(itr - beg));
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,118 @@
+#ifndef OT_SPEF_BINARY_HPP_
+#define OT_SPEF_BINARY_HPP_
+
+#include <ot/headerdef.hpp>
+#include <ot/utility/mmap.hpp>
+
+namespace ot {
+
+// Class: BinarySpef
+// A compact binary image of the net parasitics of a spef, mapped into memory as is.
+// All names (nets, pins and internal nodes) are interned in a string table, each net
+// is a fixed-size record followed by its connection, capacitance and resistance arrays,
+// and a name-sorted index of net offsets gives random access to any net.
+//
+// Layout (native byte order, 4-byte aligned records):
+//   Header | string offsets | string characters | net index | net records
+class BinarySpef {
+
+  public:
+
+    constexpr static char MAGIC[8] = {'O', 'T', 'S', 'P', 'E', 'F', 'B', '\n'};
+    constexpr static uint32_t VERSION = 1;
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t byte_order;
+      uint64_t num_strings;
+      uint64_t strings;
+      uint64_t chars;
+      uint64_t num_nets;
+      uint64_t index;
+      uint32_t design_name;
+      uint32_t time_unit;
+      uint32_t capacitance_unit;
+      uint32_t resistance_unit;
+      uint32_t inductance_unit;
+      uint32_t divider;
+      uint32_t delimiter;
+      uint32_t bus_delimiter;
+    };
+
+    struct Index {
+      uint32_t name;
+      uint32_t padding;
+      uint64_t offset;
+    };
+
+    struct Net {
+      uint32_t name;
+      float lcap;
+      uint32_t num_connections;
+      uint32_t num_caps;
+      uint32_t num_ress;
+    };
+
+    struct Connection {
+      uint32_t name;
+      uint32_t driving_cell;
+      uint8_t type;
+      uint8_t direction;
+      uint8_t has_load;
+      uint8_t has_coordinate;
+      float load;
+      float x;
+      float y;
+    };
+
+    struct Element {
+      uint32_t node1;
+      uint32_t node2;
+      float value;
+    };
+
+    static bool is_binary(const std::filesystem::path&);
+    static bool write(const spef::Spef&, const std::filesystem::path&);
+
+    bool open(const std::filesystem::path&);
+    void read_header(spef::Spef&) const;
+    void read(spef::Spef&) const;
+
+    std::optional<spef::Net> net(std::string_view) const;
+
+    spef::Net net(size_t) const;
+
+    inline size_t num_nets() const;
+    inline bool is_open() const;
+
+  private:
+
+    MappedFile _file;
+
+    const Header* _header {nullptr};
+    const uint64_t* _strings {nullptr};
+    const Index* _index {nullptr};
+
+    inline std::string_view _string(uint32_t) const;
+};
+
+// Function: num_nets
+inline size_t BinarySpef::num_nets() const {
+  return _header ? _header->num_nets : 0;
+}
+
+// Function: is_open
+inline bool BinarySpef::is_open() const {
+  return _header != nullptr;
+}
+
+// Function: _string
+inline std::string_view BinarySpef::_string(uint32_t id) const {
+  auto chars = _file.data() + _header->chars;
+  return {chars + _strings[id], _strings[id+1] - _strings[id] - 1};
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -5,6 +5,7 @@
 #include <ot/static/logger.hpp>
 #include <ot/utility/utility.hpp>
 #include <ot/unit/unit.hpp>
+#include <ot/spef/binary.hpp>
 
 /*namespace ot::spef {
 
@@ -6,58 +6,108 @@ namespace ot::tau15 {
 // Procedure: read
 void Timing::read(const std::filesystem::path& path) {
   
-  std::string line, token, pin;
-  
   // ------------------------------------------------------
   // Read timing file.
   // ------------------------------------------------------
-  std::ifstream tfs(path);
 
-  if(!tfs.good()) {
+  // stream a compressed file in chunks of whole lines
+  if(compression(path) != Compression::NONE) {
+    auto cut = [] (std::string_view buf) {
+      auto pos = buf.rfind('\n');
+      return pos == std::string_view::npos ? 0 : pos + 1;
+    };
+    if(!read_chunks(path, cut, [this] (std::string& chunk) { _read(chunk); })) {
+      OT_LOGE("can't read timing assertions ", path);
+    }
+    return;
+  }
+
+  MappedFile file(path);
+
+  if(!file.is_open()) {
     OT_LOGE("can't open timing assertions ", path);
     return;
   }
-  
-  while(std::getline(tfs, line)) {
-    
-    std::istringstream ss(line);
 
-    ss >> token;
+  _read(file.view());
+}
+
+// Procedure: _read
+// Parse a buffer of whole lines of assertions.
+void Timing::_read(std::string_view buffer) {
+
+  // keep line breaks as tokens since an assertion is a line
+  auto tokens = tokenize(buffer, "\n", "\n");
 
-    if(token == "clock") {
+  auto itr = tokens.begin();
+  auto end = tokens.end();
+
+  // make sure the current line has n more tokens
+  auto expect = [&] (std::string_view keyword, std::ptrdiff_t n) {
+    OT_LOGF_IF(
+      end - itr <= n || std::find(itr, itr + n + 1, "\n") != itr + n + 1,
+      "syntax error in ", keyword
+    );
+  };
+
+  auto tofloat = [] (std::string_view token) {
+    return std::strtof(token.data(), nullptr);
+  };
+
+  while(itr != end) {
+
+    if(*itr == "\n") {
+      ++itr;
+      continue;
+    }
+    
+    if(*itr == "clock") {
       Clock clock;
-      ss >> clock.pin >> clock.period;
+      expect("clock", 2);
+      clock.pin = *++itr;
+      clock.period = tofloat(*++itr);
       assertions.push_back(std::move(clock));
     }
-    else if(token == "at") {
+    else if(*itr == "at") {
       AT at;
-      ss >> at.pin 
-         >> at.value[ot::MIN][ot::RISE] >> at.value[ot::MIN][ot::FALL] 
-         >> at.value[ot::MAX][ot::RISE]  >> at.value[ot::MAX][ot::FALL];
+      expect("at", 5);
+      at.pin = *++itr;
+      FOR_EACH_EL_RF(el, rf) {
+        at.value[el][rf] = tofloat(*++itr);
+      }
       assertions.push_back(std::move(at));
     }
-    else if(token == "slew") {
+    else if(*itr == "slew") {
       Slew slew;
-      ss >> slew.pin
-         >> slew.value[ot::MIN][ot::RISE] >> slew.value[ot::MIN][ot::FALL]
-         >> slew.value[ot::MAX][ot::RISE] >> slew.value[ot::MAX][ot::FALL];
+      expect("slew", 5);
+      slew.pin = *++itr;
+      FOR_EACH_EL_RF(el, rf) {
+        slew.value[el][rf] = tofloat(*++itr);
+      }
       assertions.push_back(std::move(slew));
     }
-    else if(token == "rat") {
+    else if(*itr == "rat") {
       RAT rat;
-      ss >> rat.pin
-         >> rat.value[ot::MIN][ot::RISE] >> rat.value[ot::MIN][ot::FALL]
-         >> rat.value[ot::MAX][ot::RISE] >> rat.value[ot::MAX][ot::FALL];
+      expect("rat", 5);
+      rat.pin = *++itr;
+      FOR_EACH_EL_RF(el, rf) {
+        rat.value[el][rf] = tofloat(*++itr);
+      }
       assertions.push_back(std::move(rat));
     }
-    else if(token == "load") {
+    else if(*itr == "load") {
       Load load;
-      ss >> load.pin >> load.value;
+      expect("load", 2);
+      load.pin = *++itr;
+      load.value = tofloat(*++itr);
       assertions.push_back(std::move(load));
     }
     else {
-      OT_LOGF("unknown keyword ", token);
+      OT_LOGF("unknown keyword ", *itr);
     }
+
+    // ignore the rest of the line
+    itr = std::find(itr, end, "\n");
   }
 }
 
@@ -48,6 +48,9 @@ using Assertion = std::variant<
 struct Timing {
   std::vector<Assertion> assertions;
   void read(const std::filesystem::path&);
+
+  private:
+    void _read(std::string_view);
 };
 
 
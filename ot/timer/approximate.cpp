@@ -0,0 +1,188 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Function: set_approximate_update
+// Enable the approximate update mode (or disable it with std::nullopt). An approximate update
+// propagates the changes only up to the given number of logic levels past the frontiers, and
+// defers the rest of the fanout cone until the next exact update (see update_timing). Given
+// a threshold, the propagation goes on for another round of levels from each boundary pin
+// whose arrival time or slew still changes by more than the threshold.
+Timer& Timer::set_approximate_update(std::optional<size_t> depth, std::optional<float> threshold) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto op = _taskflow.emplace([this, depth, threshold] () {
+    _approx_depth = depth;
+    _approx_threshold = threshold;
+  });
+
+  _add_to_lineage(op, true);
+
+  return *this;
+}
+
+// Function: report_approximate_pins
+// Report the pins whose timing values may be stale after approximate updates, that is, the
+// fanout cones of the pins deferred by the bounded propagation.
+std::vector<std::string> Timer::report_approximate_pins() {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  std::vector<std::string> pins;
+  std::unordered_set<const Pin*> visited;
+  std::vector<const Pin*> stack(_deferred.begin(), _deferred.end());
+
+  while(!stack.empty()) {
+
+    auto pin = stack.back();
+    stack.pop_back();
+
+    if(!visited.insert(pin).second) {
+      continue;
+    }
+
+    pins.push_back(pin->_name);
+
+    for(auto arc : pin->_fanout) {
+      stack.push_back(&(arc->_to));
+    }
+  }
+
+  std::sort(pins.begin(), pins.end());
+
+  return pins;
+}
+
+// Procedure: _build_fprop_bound
+// Perform the BFS from the frontiers to mark the pins within the given number of logic
+// levels, and collect the boundary pins together with their arrival times and slews before
+// the propagation. The fprop candidates are then discovered within the marked pins only.
+void Timer::_build_fprop_bound(size_t depth) {
+
+  std::vector<std::pair<Pin*, size_t>> queue;
+
+  for(auto ftr : _frontiers) {
+    if(!ftr->_has_state(Pin::FPROP_BOUND)) {
+      ftr->_insert_state(Pin::FPROP_BOUND);
+      queue.emplace_back(ftr, 0);
+    }
+  }
+
+  for(size_t i=0; i<queue.size(); ++i) {
+
+    auto [pin, level] = queue[i];
+
+    if(level < depth) {
+      for(auto arc : pin->_fanout) {
+        if(auto& to = arc->_to; !to._has_state(Pin::FPROP_BOUND)) {
+          to._insert_state(Pin::FPROP_BOUND);
+          queue.emplace_back(&to, level + 1);
+        }
+      }
+      continue;
+    }
+
+    // pins of all lower levels are marked at this point
+    FpropBoundary boundary {pin};
+
+    for(auto arc : pin->_fanout) {
+      if(auto& to = arc->_to; !to._has_state(Pin::FPROP_BOUND)) {
+        boundary.fanouts.push_back(&to);
+      }
+    }
+
+    if(boundary.fanouts.empty()) {
+      continue;
+    }
+
+    FOR_EACH_EL_RF(el, rf) {
+      boundary.at[el][rf] = pin->at(el, rf);
+      boundary.slew[el][rf] = pin->slew(el, rf);
+    }
+
+    _fprop_boundary.push_back(std::move(boundary));
+  }
+
+  _fprop_bounded = true;
+}
+
+// Procedure: _defer_fprop_bound
+// Decide the fate of the fanouts skipped by a bounded propagation: they are up-to-date if the
+// boundary pin did not change, become the frontiers of the next round if it changed more than
+// the threshold, or are deferred.
+void Timer::_defer_fprop_bound() {
+
+  // the change of a timing value (appearing or disappearing counts as unbounded)
+  auto delta = [] (const std::optional<float>& a, const std::optional<float>& b) {
+    if(a && b) {
+      return std::fabs(*a - *b);
+    }
+    return (a || b) ? std::numeric_limits<float>::max() : 0.0f;
+  };
+
+  for(const auto& boundary : _fprop_boundary) {
+
+    auto d = 0.0f;
+
+    FOR_EACH_EL_RF(el, rf) {
+      d = std::max({
+        d,
+        delta(boundary.at[el][rf], boundary.pin->at(el, rf)),
+        delta(boundary.slew[el][rf], boundary.pin->slew(el, rf))
+      });
+    }
+
+    if(d == 0.0f) {
+      continue;
+    }
+
+    for(auto pin : boundary.fanouts) {
+      if(_approx_threshold && d > *_approx_threshold) {
+        _insert_frontier(*pin);
+      }
+      else {
+        _insert_deferred(*pin);
+      }
+    }
+  }
+
+  _fprop_boundary.clear();
+  _fprop_bounded = false;
+}
+
+// Procedure: _insert_deferred
+void Timer::_insert_deferred(Pin& pin) {
+  if(!pin._deferred_satellite) {
+    pin._deferred_satellite = _deferred.insert(_deferred.end(), &pin);
+  }
+}
+
+// Procedure: _remove_deferred
+void Timer::_remove_deferred(Pin& pin) {
+  if(pin._deferred_satellite) {
+    _deferred.erase(*pin._deferred_satellite);
+    pin._deferred_satellite.reset();
+  }
+}
+
+// Procedure: _clear_deferred
+void Timer::_clear_deferred() {
+  for(auto pin : _deferred) {
+    pin->_deferred_satellite.reset();
+  }
+  _deferred.clear();
+}
+
+// Procedure: _reconcile_deferred
+// Move the deferred pins to the frontiers such that the next update propagates them.
+void Timer::_reconcile_deferred() {
+  for(auto pin : _deferred) {
+    _insert_frontier(*pin);
+  }
+  _clear_deferred();
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,20 @@
+#ifndef OT_TIMER_APPROXIMATE_HPP_
+#define OT_TIMER_APPROXIMATE_HPP_
+
+#include <ot/timer/pin.hpp>
+
+namespace ot {
+
+// Struct: FpropBoundary
+// A pin at the last level of a bounded (approximate) propagation, its fanouts beyond the
+// bound, and its timing values before the propagation.
+struct FpropBoundary {
+  Pin* pin;
+  std::vector<Pin*> fanouts;
+  TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> at;
+  TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> slew;
+};
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -76,12 +76,48 @@ void Arc::_remap_timing(Split el, const Timing& timing) {
 void Arc::_reset_delay() {
   FOR_EACH_EL_RF_RF(el, frf, trf) {
     _delay[el][frf][trf].reset();
-    _ipower[el][frf][trf].reset();
   }
 }
 
+// Function: _lut
+// Evaluate the lookup tables of a cell arc at an input slew and an output load, or reuse the
+// last evaluation if the timing is the same and the input slew and the load are within the
+// tolerance of the last ones (a zero tolerance requires the same values).
+const LutMemo& Arc::_lut(
+  Split el, Tran frf, Tran trf, const Timing& timing, float si, float lc, float tolerance,
+  LutStats* stats
+) {
+
+  if(!_memo) {
+    _memo = std::make_unique<TimingData<LutMemo, MAX_SPLIT, MAX_TRAN, MAX_TRAN>>();
+  }
+
+  auto& memo = (*_memo)[el][frf][trf];
+
+  if(memo.timing == &timing &&
+     std::fabs(memo.slew_in - si) <= tolerance &&
+     std::fabs(memo.load - lc) <= tolerance) {
+    if(stats) {
+      ++stats->num_hits;
+    }
+    return memo;
+  }
+
+  if(stats) {
+    ++stats->num_misses;
+  }
+
+  memo.timing  = &timing;
+  memo.slew_in = si;
+  memo.load    = lc;
+  memo.slew    = timing.slew(frf, trf, si, lc);
+  memo.delay   = timing.delay(frf, trf, si, lc);
+
+  return memo;
+}
+
 // Procedure: _fprop_slew
-void Arc::_fprop_slew() {
+void Arc::_fprop_slew(float tolerance, LutStats& stats) {
 
   if(_has_state(LOOP_BREAKER)) {
     return;
@@ -99,11 +135,12 @@ void Arc::_fprop_slew() {
       }
     },
     // Case 2: Cell arc
-    [this] (TimingView tv) {
+    [this, tolerance, &stats] (TimingView tv) {
       FOR_EACH_EL_RF_RF_IF(el, frf, trf, (tv[el] && _from._slew[el][frf])) {
         auto lc = (_to._net) ? _to._net->_load(el, trf) : 0.0f;
-        if(auto so = tv[el]->slew(frf, trf, *_from._slew[el][frf], lc); so) {
-          _to._relax_slew(this, el, frf, el, trf, *so);
+        auto& memo = _lut(el, frf, trf, *tv[el], *_from._slew[el][frf], lc, tolerance, &stats);
+        if(memo.slew) {
+          _to._relax_slew(this, el, frf, el, trf, *memo.slew);
         }
       }
     }
@@ -111,7 +148,8 @@ void Arc::_fprop_slew() {
 }
 
 // Procedure: _fprop_delay
-void Arc::_fprop_delay() {
+// The lookup tables are evaluated (or reused) by _fprop_slew at the same input slew and load.
+void Arc::_fprop_delay(float tolerance) {
   
   if(_has_state(LOOP_BREAKER)) {
     return;
@@ -125,21 +163,48 @@ void Arc::_fprop_delay() {
       }
     },
     // Case 2: Cell arc
-    [this] (TimingView tv) {
+    [this, tolerance] (TimingView tv) {
       FOR_EACH_EL_RF_RF_IF(el, frf, trf, (tv[el] && _from._slew[el][frf])) {
         auto lc = (_to._net) ? _to._net->_load(el, trf) : 0.0f;
-        auto si = *_from._slew[el][frf];
-        auto delay = tv[el]->delay(frf, trf, si, lc);
-        _delay[el][frf][trf] = delay;
-        auto ipower = tv[el]->internal_power.power(frf, trf, si, lc);
-        _ipower[el][frf][trf] = ipower;
-
-        //std::cout << " name:" << _from._name << " delay:" << *delay << " slew:" << si << " lc:" << lc << " ipower:" << *ipower << "\n";
+        auto& memo = _lut(el, frf, trf, *tv[el], *_from._slew[el][frf], lc, tolerance, nullptr);
+        _delay[el][frf][trf] = memo.delay;
       }
     }
   }, _handle);
 }
 
+// Function: _eval_ipower
+// Evaluate the internal power of a cell arc at the current input slew and output load.
+std::optional<float> Arc::_eval_ipower(Split el, Tran frf, Tran trf) const {
+
+  if(_has_state(LOOP_BREAKER)) {
+    return std::nullopt;
+  }
+
+  if(auto tv = std::get_if<TimingView>(&_handle); tv && (*tv)[el] && _from._slew[el][frf]) {
+    auto lc = (_to._net) ? _to._net->_load(el, trf) : 0.0f;
+    return (*tv)[el]->internal_power.power(frf, trf, *_from._slew[el][frf], lc);
+  }
+
+  return std::nullopt;
+}
+
+// Procedure: _update_ipower
+void Arc::_update_ipower() {
+
+  if(!is_cell_arc()) {
+    return;
+  }
+
+  if(!_ipower) {
+    _ipower = std::make_unique<TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN>>();
+  }
+
+  FOR_EACH_EL_RF_RF(el, frf, trf) {
+    (*_ipower)[el][frf][trf] = _eval_ipower(el, frf, trf);
+  }
+}
+
 // Procedure: _fprop_at
 void Arc::_fprop_at() {
   
@@ -12,6 +12,34 @@ class Test;
 
 // ------------------------------------------------------------------------------------------------
 
+// Struct: LutMemo
+// The last evaluation of the lookup tables of a cell arc for a pair of transitions, keyed by
+// the timing, the input slew and the output load it was evaluated at.
+struct LutMemo {
+  const Timing* timing {nullptr};
+  float slew_in {0.0f};
+  float load {0.0f};
+  std::optional<float> slew;
+  std::optional<float> delay;
+};
+
+// Struct: LutStats
+// The numbers of lookup-table evaluations of cell arcs reused from the memo (hits) and
+// evaluated (misses) during propagation.
+struct LutStats {
+  size_t num_hits {0};
+  size_t num_misses {0};
+  inline float hit_rate() const;
+};
+
+// Function: hit_rate
+inline float LutStats::hit_rate() const {
+  auto n = num_hits + num_misses;
+  return n == 0 ? 0.0f : static_cast<float>(num_hits) / n;
+}
+
+// ------------------------------------------------------------------------------------------------
+
 // Class: Arc
 class Arc {
 
@@ -60,18 +88,28 @@ class Arc {
     std::optional<std::list<Arc*>::iterator> _fanin_satellite;
     
     TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN> _delay;
-    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN> _ipower;
+
+    // evaluated on demand by the power analysis (see Timer::_update_ipower)
+    std::unique_ptr<TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN>> _ipower;
+
+    // allocated at the first evaluation of a cell arc
+    std::unique_ptr<TimingData<LutMemo, MAX_SPLIT, MAX_TRAN, MAX_TRAN>> _memo;
 
     void _remap_timing(Split, const Timing&);
-    void _fprop_slew();
+    void _fprop_slew(float, LutStats&);
     void _fprop_at();
     void _reset_delay();
-    void _fprop_delay();
+    void _fprop_delay(float);
+    void _update_ipower();
     void _bprop_rat();
     void _insert_state(int);
     void _remove_state(int = 0);
 
     bool _has_state(int) const;
+
+    const LutMemo& _lut(Split, Tran, Tran, const Timing&, float, float, float, LutStats*);
+
+    std::optional<float> _eval_ipower(Split, Tran, Tran) const;
 }; 
 
 // Function: idx
@@ -0,0 +1,254 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Function: insert_buffer
+// Insert a buffer gate of the given cell between a net and a subset of its sinks, which are
+// moved to a new net driven by the buffer. This is the same as the sequence insert_gate,
+// insert_net, disconnect_pin and connect_pin (buffer input, buffer output and each sink) but
+// is applied at once, and the nets can be given their new parasitics.
+Timer& Timer::insert_buffer(
+  std::string net,
+  std::vector<std::string> sinks,
+  std::string cell,
+  std::string gate,
+  std::string buffered_net,
+  std::optional<spef::Net> net_parasitics,
+  std::optional<spef::Net> buffered_net_parasitics
+) {
+
+  std::scoped_lock lock(_mutex);
+
+  // the parasitics are not logged by a transaction
+  bool reversible = !net_parasitics && !buffered_net_parasitics;
+
+  auto task = _taskflow.emplace([
+    this,
+    net=std::move(net),
+    sinks=std::move(sinks),
+    cell=std::move(cell),
+    gate=std::move(gate),
+    buffered_net=std::move(buffered_net),
+    np=std::move(net_parasitics),
+    bp=std::move(buffered_net_parasitics)
+  ] () mutable {
+    _insert_buffer(net, sinks, cell, gate, buffered_net, std::move(np), std::move(bp));
+  });
+
+  _add_to_lineage(task, reversible);
+
+  return *this;
+}
+
+// Procedure: _insert_buffer
+void Timer::_insert_buffer(
+  const std::string& nname,
+  const std::vector<std::string>& snames,
+  const std::string& cname,
+  const std::string& gname,
+  const std::string& bname,
+  std::optional<spef::Net> np,
+  std::optional<spef::Net> bp
+) {
+
+  OT_LOGE_RIF(!_celllib[MIN] || !_celllib[MAX], "celllib not found");
+
+  auto nitr = _nets.find(nname);
+
+  OT_LOGE_RIF(
+    nitr == _nets.end(), "can't insert buffer ", gname, " (net ", nname, " not found)"
+  );
+
+  auto& net = nitr->second;
+
+  OT_LOGE_RIF(!net._root, "can't insert buffer ", gname, " (net ", nname, " has no driver)");
+
+  OT_LOGE_RIF(
+    _gates.find(gname) != _gates.end(), "can't insert buffer ", gname, " (gate already existed)"
+  );
+
+  OT_LOGE_RIF(
+    _nets.find(bname) != _nets.end(), 
+    "can't insert buffer ", gname, " (net ", bname, " already existed)"
+  );
+
+  auto bpins = _buffer_cellpins(cname);
+
+  OT_LOGE_RIF(!bpins, "can't insert buffer ", gname, " (", cname, " is not a buffer cell)");
+
+  // the sinks must be the leaves of the net
+  std::vector<Pin*> sinks;
+
+  sinks.reserve(snames.size());
+
+  for(const auto& sname : snames) {
+    auto itr = _pins.find(sname);
+    OT_LOGE_RIF(
+      itr == _pins.end() || itr->second._net != &net || &(itr->second) == net._root,
+      "can't insert buffer ", gname, " (", sname, " is not a sink of net ", nname, ")"
+    );
+    sinks.push_back(&(itr->second));
+  }
+
+  OT_LOGE_RIF(
+    (np && np->name != nname) || (bp && bp->name != bname),
+    "can't insert buffer ", gname, " (parasitics of a different net)"
+  );
+
+  // log the undo (the sinks are reconnected to the net, and the buffered net and the
+  // buffer are removed)
+  _record_gate(gname);
+  _record_insert_net(bname);
+
+  for(const auto& sname : snames) {
+    _record_pin(sname, bname);
+  }
+
+  // insert the buffer and the buffered net
+  _insert_gate(gname, cname);
+
+  auto& bnet = _insert_net(bname);
+  auto& in   = _pins.at(gname + ':' + bpins->first);
+  auto& out  = _pins.at(gname + ':' + bpins->second);
+
+  _connect_pin(in, net);
+  _connect_pin(out, bnet);
+
+  // move the sinks from the net to the buffered net; each sink has only the net arc from the
+  // driver as its fanin.
+  for(auto sink : sinks) {
+    if(auto arc = sink->_find_fanin(*net._root); arc) {
+      _remove_arc(*arc);
+    }
+    net._remove_pin(*sink);
+    _connect_pin(*sink, bnet);
+  }
+
+  // attach the new parasitics
+  if(np && net._attach(std::move(*np))) {
+    _insert_frontier(*net._root);
+  }
+
+  if(bp && bnet._attach(std::move(*bp))) {
+    _insert_frontier(out);
+  }
+}
+
+// Function: remove_buffer
+// Remove a buffer gate and its output net, and move the sinks of the output net to the net
+// driving the buffer, which can be given its new parasitics.
+Timer& Timer::remove_buffer(std::string gate, std::optional<spef::Net> net_parasitics) {
+
+  std::scoped_lock lock(_mutex);
+
+  // the parasitics are not logged by a transaction
+  bool reversible = !net_parasitics;
+
+  auto task = _taskflow.emplace([
+    this, gate=std::move(gate), np=std::move(net_parasitics)
+  ] () mutable {
+    _remove_buffer(gate, std::move(np));
+  });
+
+  _add_to_lineage(task, reversible);
+
+  return *this;
+}
+
+// Procedure: _remove_buffer
+void Timer::_remove_buffer(const std::string& gname, std::optional<spef::Net> np) {
+
+  auto gitr = _gates.find(gname);
+
+  OT_LOGE_RIF(gitr == _gates.end(), "can't remove buffer ", gname, " (gate not found)");
+
+  auto& gate = gitr->second;
+  auto bpins = _buffer_cellpins(gate.cell_name());
+
+  OT_LOGE_RIF(
+    !bpins, "can't remove buffer ", gname, " (", gate.cell_name(), " is not a buffer cell)"
+  );
+
+  auto& in  = _pins.at(gname + ':' + bpins->first);
+  auto& out = _pins.at(gname + ':' + bpins->second);
+
+  OT_LOGE_RIF(
+    !in._net || !in._net->_root || !out._net,
+    "can't remove buffer ", gname, " (buffer not connected)"
+  );
+
+  auto& net  = *in._net;
+  auto& bnet = *out._net;
+
+  OT_LOGE_RIF(
+    np && np->name != net._name, "can't remove buffer ", gname, " (parasitics of a different net)"
+  );
+
+  std::vector<Pin*> sinks;
+
+  for(auto pin : bnet._pins) {
+    if(pin != &out) {
+      sinks.push_back(pin);
+    }
+  }
+
+  // log the undo (the buffered net, the buffer and its connections are restored, and then the
+  // sinks are reconnected to the buffered net)
+  _record_remove_net(bnet._name);
+  _record_gate(gname);
+
+  for(auto sink : sinks) {
+    _record_pin(sink->_name, net._name);
+  }
+
+  // move the sinks from the buffered net to the net
+  for(auto sink : sinks) {
+    if(auto arc = sink->_find_fanin(out); arc) {
+      _remove_arc(*arc);
+    }
+    bnet._remove_pin(*sink);
+    _connect_pin(*sink, net);
+  }
+
+  // remove the buffer and the buffered net
+  _remove_gate(gate);
+  _remove_net(bnet);
+
+  // attach the new parasitics
+  if(np && net._attach(std::move(*np))) {
+    _insert_frontier(*net._root);
+  }
+}
+
+// Function: _buffer_cellpins
+// Find the names of the input and the output cellpins of a buffer cell, which has exactly one
+// input and one output.
+std::optional<std::pair<std::string, std::string>> Timer::_buffer_cellpins(
+  const std::string& cname
+) const {
+
+  auto cell = _celllib[MIN] ? _celllib[MIN]->cell(cname) : nullptr;
+
+  if(cell == nullptr || cell->cellpins.size() != 2) {
+    return std::nullopt;
+  }
+
+  std::optional<std::string> in, out;
+
+  for(const auto& [cpname, cp] : cell->cellpins) {
+    if(cp.direction == CellpinDirection::INPUT) {
+      in = cpname;
+    }
+    else if(cp.direction == CellpinDirection::OUTPUT) {
+      out = cpname;
+    }
+  }
+
+  if(!in || !out) {
+    return std::nullopt;
+  }
+
+  return std::make_pair(std::move(*in), std::move(*out));
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
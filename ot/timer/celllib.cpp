@@ -26,6 +26,10 @@ bool Timer::_is_redundant_timing(const Timing& timing, Split el) const {
 Timer& Timer::read_celllib(std::filesystem::path path, std::optional<Split> el) {
   
   auto lib = std::make_shared<Celllib>();
+
+  // the library is referred to by its absolute path in a checkpoint
+  std::error_code ec;
+  auto abs = std::filesystem::absolute(path, ec);
   
   std::scoped_lock lock(_mutex);
   
@@ -36,14 +40,17 @@ Timer& Timer::read_celllib(std::filesystem::path path, std::optional<Split> el)
   });
 
   // Placeholder to add_lineage
-  auto reader = _taskflow.emplace([this, lib, el] () {
+  auto reader = _taskflow.emplace([this, lib, el, abs=std::move(abs)] () {
     if(el) {
       _merge_celllib(*lib, *el);
+      _celllib_paths[*el].push_back(abs);
     }
     else {
       auto cpy = *lib;
       _merge_celllib(cpy, MIN);
       _merge_celllib(*lib, MAX);
+      _celllib_paths[MIN].push_back(abs);
+      _celllib_paths[MAX].push_back(abs);
     }
   });
 
@@ -58,11 +65,20 @@ Timer& Timer::read_celllib(std::filesystem::path path, std::optional<Split> el)
 // Procedure: _merge_celllib
 void Timer::_merge_celllib(Celllib& lib, Split el) {
 
+  // a library shared with a forked timer is read-only
+  if(_celllib[el] && _celllib[el].use_count() > 1) {
+    OT_LOGE(
+      "can't merge ", std::quoted(lib.name), " into the ", to_string(el), 
+      " celllib shared with a forked timer"
+    );
+    return;
+  }
+
   _rebase_unit(lib);
 
   // initialize a library
   if(!_celllib[el]) {
-    _celllib[el] = std::move(lib);
+    _celllib[el] = std::make_shared<Celllib>(std::move(lib));
     OT_LOGI(
       "added ", to_string(el), " celllib ", std::quoted(_celllib[el]->name), 
       " [cells:", _celllib[el]->cells.size(), ']'
@@ -81,6 +97,17 @@ void Timer::_merge_celllib(Celllib& lib, Split el) {
       " [cells:", _celllib[el]->cells.size(), ']'
     );
   }
+
+  _celllib[el]->index_footprints();
+}
+
+// Function: report_equivalent_cells
+// Return the group of cells interchangeable with the given cell, presorted by area and by 
+// drive strength.
+const Footprint* Timer::report_equivalent_cells(const std::string& cell, Split el) {
+  std::scoped_lock lock(_mutex);
+  _update_timing();
+  return _celllib[el] ? _celllib[el]->footprint(cell) : nullptr;
 }
 
 };  // end of namespace ot. -----------------------------------------------------------------------
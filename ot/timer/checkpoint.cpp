@@ -0,0 +1,567 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Constructor
+Checkpoint::Writer::Writer(std::ostream& os) : _os {os} {
+}
+
+// Procedure: put
+// Write a string as its size followed by its characters.
+void Checkpoint::Writer::put(std::string_view s) {
+  put(static_cast<uint32_t>(s.size()));
+  _os.write(s.data(), s.size());
+}
+
+// Constructor
+Checkpoint::Reader::Reader(std::string_view data) : _data {data} {
+}
+
+// Function: get_string
+// Read a string in place.
+std::string_view Checkpoint::Reader::get_string() {
+  return get_bytes(get<uint32_t>());
+}
+
+// Function: get_count
+// Read the number of records of a section; a count beyond the remaining bytes fails the
+// reader (each record takes at least one byte).
+size_t Checkpoint::Reader::get_count() {
+
+  auto n = get<uint32_t>();
+
+  if(_good && n > _data.size() - _offset) {
+    _good = false;
+  }
+
+  return _good ? n : 0;
+}
+
+// Function: get_bytes
+// Read a number of bytes in place; a read past the end gives an empty view and fails
+// the reader.
+std::string_view Checkpoint::Reader::get_bytes(size_t n) {
+
+  if(!_good || _offset + n > _data.size()) {
+    _good = false;
+    return {};
+  }
+
+  auto s = _data.substr(_offset, n);
+  _offset += n;
+  return s;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Procedure: save_checkpoint
+// Save the design to a binary checkpoint after all pending operations are applied.
+void Timer::save_checkpoint(const std::filesystem::path& path) {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  std::ofstream ofs(path, std::ios::binary);
+
+  if(!ofs.good()) {
+    OT_LOGE("failed to open checkpoint ", path);
+    return;
+  }
+
+  _save_checkpoint(ofs);
+
+  if(!ofs.good()) {
+    OT_LOGE("failed to write checkpoint ", path);
+  }
+  else {
+    OT_LOGI("saved checkpoint ", path);
+  }
+}
+
+// Function: load_checkpoint
+// Restore a design from a binary checkpoint.
+Timer& Timer::load_checkpoint(std::filesystem::path path) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto task = _taskflow.emplace([this, path=std::move(path)] (tf::Subflow& sf) {
+
+    OT_LOGI("loading checkpoint ", path);
+
+    MappedFile file;
+
+    if(!file.open(path)) {
+      OT_LOGE("failed to open checkpoint ", path);
+      return;
+    }
+
+    if(!_load_checkpoint(file.view(), sf)) {
+      OT_LOGE("corrupted checkpoint ", path);
+    }
+  });
+
+  _add_to_lineage(task);
+
+  return *this;
+}
+
+// Function: fork
+// Create a clone of the timer from an in-memory checkpoint of the design. The clone shares
+// the libraries with the timer and owns the netlist, parasitics and constraints restored from
+// the checkpoint, such that it can be edited and updated from another thread independently.
+std::unique_ptr<Timer> Timer::fork() {
+
+  auto image = std::make_shared<std::string>();
+  auto clone = std::make_unique<Timer>();
+
+  {
+    std::scoped_lock lock(_mutex);
+
+    _update_timing();
+
+    std::ostringstream oss;
+    _save_checkpoint(oss);
+    *image = oss.str();
+
+    clone->_celllib = _celllib;
+    clone->_celllib_paths = _celllib_paths;
+  }
+
+  auto task = clone->_taskflow.emplace([timer=clone.get(), image] (tf::Subflow& sf) {
+    if(!timer->_load_checkpoint(*image, sf)) {
+      OT_LOGE("failed to fork timer");
+    }
+  });
+
+  clone->_add_to_lineage(task);
+
+  return clone;
+}
+
+// Procedure: _save_checkpoint
+void Timer::_save_checkpoint(std::ostream& os) const {
+
+  Checkpoint::Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, Checkpoint::MAGIC, sizeof(Checkpoint::MAGIC));
+  header.version    = Checkpoint::VERSION;
+  header.byte_order = Checkpoint::ORDER_MARK;
+
+  // the size of the checkpoint is patched after all sections are written
+  const auto beg = os.tellp();
+
+  Checkpoint::Writer w(os);
+
+  w.put(header);
+
+  // units
+  auto put_unit = [&] (const auto& unit) {
+    w.put(static_cast<uint8_t>(unit.has_value()));
+    w.put(unit ? static_cast<double>(unit->value()) : 0.0);
+  };
+
+  put_unit(_time_unit);
+  put_unit(_capacitance_unit);
+  put_unit(_resistance_unit);
+  put_unit(_voltage_unit);
+  put_unit(_current_unit);
+  put_unit(_power_unit);
+
+  // libraries
+  FOR_EACH_EL(el) {
+    w.put(static_cast<uint32_t>(_celllib_paths[el].size()));
+    for(const auto& path : _celllib_paths[el]) {
+      w.put(std::string_view(path.native()));
+    }
+  }
+
+  // netlist: ports and their nets, nets, gates and their pin-to-net connections
+  auto net_name = [] (const Pin& pin) {
+    return pin._net ? std::string_view(pin._net->_name) : std::string_view();
+  };
+
+  w.put(static_cast<uint32_t>(_pis.size()));
+  for(const auto& [name, pi] : _pis) {
+    w.put(std::string_view(name));
+    w.put(net_name(pi._pin));
+  }
+
+  w.put(static_cast<uint32_t>(_pos.size()));
+  for(const auto& [name, po] : _pos) {
+    w.put(std::string_view(name));
+    w.put(net_name(po._pin));
+  }
+
+  w.put(static_cast<uint32_t>(_nets.size()));
+  for(const auto& kvp : _nets) {
+    w.put(std::string_view(kvp.first));
+  }
+
+  w.put(static_cast<uint32_t>(_gates.size()));
+  for(const auto& [name, gate] : _gates) {
+    w.put(std::string_view(name));
+    w.put(std::string_view(gate.cell_name()));
+    w.put(static_cast<uint32_t>(std::count_if(gate._pins.begin(), gate._pins.end(),
+      [] (const Pin* pin) { return pin->_net != nullptr; }
+    )));
+    for(auto pin : gate._pins) {
+      if(pin->_net) {
+        w.put(std::string_view(std::get<CellpinView>(pin->_handle)[MIN]->name));
+        w.put(net_name(*pin));
+      }
+    }
+  }
+
+  // rc trees
+  std::ostringstream rct_os;
+
+  w.put(static_cast<uint32_t>(std::count_if(_nets.begin(), _nets.end(), [] (const auto& kvp) {
+    return std::holds_alternative<Rct>(kvp.second._rct);
+  })));
+
+  for(const auto& [name, net] : _nets) {
+
+    auto rct = std::get_if<Rct>(&net._rct);
+
+    if(rct == nullptr) {
+      continue;
+    }
+
+    rct_os.str("");
+
+    Checkpoint::Writer r(rct_os);
+
+    r.put(std::string_view(name));
+    r.put(static_cast<uint8_t>(net._spef_hash.has_value()));
+    r.put(static_cast<uint64_t>(net._spef_hash.value_or(0)));
+
+    std::unordered_map<const RctNode*, uint32_t> ids;
+
+    r.put(static_cast<uint32_t>(rct->_nodes.size()));
+    for(const auto& [key, node] : rct->_nodes) {
+      ids.try_emplace(&node, ids.size());
+      r.put(std::string_view(key));
+      r.put(node._ncap);
+    }
+
+    r.put(static_cast<uint32_t>(rct->_edges.size()));
+    for(const auto& edge : rct->_edges) {
+      r.put(ids.at(&edge._from));
+      r.put(ids.at(&edge._to));
+      r.put(edge._res);
+    }
+
+    w.put(std::string_view(rct_os.str()));
+  }
+
+  // constraints
+  for(const auto& [name, pi] : _pis) {
+    w.put(std::string_view(name));
+    w.put(pi._at);
+    w.put(pi._slew);
+  }
+
+  for(const auto& [name, po] : _pos) {
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> load;
+    FOR_EACH_EL_RF(el, rf) {
+      load[el][rf] = po._load[el][rf];
+    }
+    w.put(std::string_view(name));
+    w.put(po._rat);
+    w.put(load);
+  }
+
+  // clocks
+  w.put(static_cast<uint32_t>(_clocks.size()));
+  for(const auto& [name, clock] : _clocks) {
+    w.put(std::string_view(name));
+    w.put(clock._source ? std::string_view(clock._source->name()) : std::string_view());
+    w.put(clock._period);
+    w.put(clock._waveform);
+  }
+
+  // cppr
+  w.put(static_cast<uint8_t>(_cppr_analysis.has_value()));
+
+  // patch the size
+  header.size = static_cast<uint64_t>(os.tellp() - beg);
+  os.seekp(beg);
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  os.seekp(0, std::ios::end);
+}
+
+// Function: _load_checkpoint
+// Restore the design from a checkpoint image. The image is decoded (and validated) first,
+// and then the libraries are read for a split with no library, the netlist is rebuilt 
+// through the verilog reader, and the rc trees of the nets are restored in parallel.
+bool Timer::_load_checkpoint(std::string_view data, tf::Subflow& sf) {
+
+  using Names = std::vector<std::pair<std::string_view, std::string_view>>;
+
+  Checkpoint::Reader r(data);
+
+  auto header = r.get<Checkpoint::Header>();
+
+  if(!r.good() ||
+     std::memcmp(header.magic, Checkpoint::MAGIC, sizeof(Checkpoint::MAGIC)) != 0 ||
+     header.version != Checkpoint::VERSION ||
+     header.byte_order != Checkpoint::ORDER_MARK ||
+     header.size != data.size()) {
+    return false;
+  }
+
+  // units
+  std::array<std::optional<double>, 6> units;
+
+  for(auto& unit : units) {
+    auto has = r.get<uint8_t>();
+    auto val = r.get<double>();
+    if(has) {
+      unit = val;
+    }
+  }
+
+  // libraries
+  std::vector<std::pair<Split, std::filesystem::path>> libpaths;
+
+  FOR_EACH_EL(el) {
+    for(auto n = r.get_count(); n; --n) {
+      libpaths.emplace_back(el, r.get_string());
+    }
+  }
+
+  // netlist
+  vlog::Netlist netlist;
+
+  auto& module = netlist.modules.emplace_back();
+
+  Names pis(r.get_count());
+  for(auto& [name, net] : pis) {
+    name = r.get_string();
+    net  = r.get_string();
+    module.inputs.emplace_back(name);
+  }
+
+  Names pos(r.get_count());
+  for(auto& [name, net] : pos) {
+    name = r.get_string();
+    net  = r.get_string();
+    module.outputs.emplace_back(name);
+  }
+
+  module.wires.resize(r.get_count());
+  for(auto& wire : module.wires) {
+    wire = r.get_string();
+  }
+
+  module.gates.resize(r.get_count());
+  for(auto& gate : module.gates) {
+    gate.name = r.get_string();
+    gate.cell = r.get_string();
+    for(auto n = r.get_count(); n; --n) {
+      auto cellpin = r.get_string();
+      gate.cellpin2net.try_emplace(std::string(cellpin), r.get_string());
+    }
+  }
+
+  // rc trees
+  std::vector<std::string_view> rcts(r.get_count());
+  for(auto& rct : rcts) {
+    rct = r.get_string();
+  }
+
+  // constraints
+  Names constraints(pis.size() + pos.size());
+  for(auto& [name, values] : constraints) {
+    name = r.get_string();
+    values = r.get_bytes(2 * sizeof(TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN>));
+  }
+
+  // clocks
+  struct ClockRecord {
+    std::string_view name;
+    std::string_view source;
+    float period;
+    std::array<float, MAX_TRAN> waveform;
+  };
+
+  std::vector<ClockRecord> clocks(r.get_count());
+  for(auto& [name, source, period, waveform] : clocks) {
+    name = r.get_string();
+    source = r.get_string();
+    period = r.get<float>();
+    waveform = r.get<std::array<float, MAX_TRAN>>();
+  }
+
+  auto cppr = r.get<uint8_t>();
+
+  if(!r.good()) {
+    return false;
+  }
+
+  // Step 1: units
+  if(units[0]) _to_time_unit(second_t(*units[0]));
+  if(units[1]) _to_capacitance_unit(farad_t(*units[1]));
+  if(units[2]) _to_resistance_unit(ohm_t(*units[2]));
+  if(units[3]) _to_voltage_unit(volt_t(*units[3]));
+  if(units[4]) _to_current_unit(ampere_t(*units[4]));
+  if(units[5]) _to_power_unit(watt_t(*units[5]));
+
+  std::atomic<bool> good {true};
+
+  // Step 2: libraries (parsed in parallel and merged in order)
+  auto libraries = sf.emplace([&] (tf::Subflow& lsf) {
+
+    FOR_EACH_EL(el) {
+      if(_celllib[el]) {
+        OT_LOGI("keep the ", to_string(el), " celllib");
+        libpaths.erase(std::remove_if(libpaths.begin(), libpaths.end(), [el=el] (auto& p) { 
+          return p.first == el; 
+        }), libpaths.end());
+      }
+    }
+
+    std::vector<Celllib> libs(libpaths.size());
+
+    lsf.for_each_index(size_t{0}, libpaths.size(), size_t{1}, [&] (size_t i) {
+      OT_LOGI("loading celllib ", libpaths[i].second);
+      libs[i].read(libpaths[i].second);
+    });
+
+    lsf.join();
+
+    for(size_t i=0; i<libpaths.size(); ++i) {
+      _merge_celllib(libs[i], libpaths[i].first);
+      _celllib_paths[libpaths[i].first].push_back(libpaths[i].second);
+    }
+  });
+
+  // Step 3: netlist and the ports reconnected to nets of other names
+  auto verilog = sf.emplace([&] (tf::Subflow& vsf) {
+
+    _verilog(netlist, vsf);
+
+    auto reconnect = [&] (Pin& pin, std::string_view net) {
+      if(net == (pin._net ? std::string_view(pin._net->_name) : std::string_view())) {
+        return;
+      }
+      if(pin._net) {
+        _disconnect_pin(pin);
+      }
+      if(!net.empty()) {
+        _connect_pin(pin, _insert_net(std::string(net)));
+      }
+    };
+
+    for(const auto& [name, net] : pis) {
+      reconnect(_pis.at(std::string(name))._pin, net);
+    }
+
+    for(const auto& [name, net] : pos) {
+      reconnect(_pos.at(std::string(name))._pin, net);
+    }
+  });
+
+  // Step 4: rc trees (each net in parallel)
+  auto rctrees = sf.for_each_index(size_t{0}, rcts.size(), size_t{1}, [&] (size_t i) {
+
+    Checkpoint::Reader n(rcts[i]);
+
+    auto itr = _nets.find(std::string(n.get_string()));
+
+    if(itr == _nets.end()) {
+      good = false;
+      return;
+    }
+
+    auto& net = itr->second;
+
+    auto has_hash = n.get<uint8_t>();
+    auto hash = n.get<uint64_t>();
+
+    auto& rct = net._rct.emplace<Rct>();
+
+    std::vector<RctNode*> nodes(n.get_count());
+
+    for(auto& node : nodes) {
+      auto name = std::string(n.get_string());
+      node = &(rct._nodes[name]);
+      node->_name = std::move(name);
+      node->_ncap = n.get<decltype(node->_ncap)>();
+    }
+
+    for(auto e = n.get_count(); e; --e) {
+      auto from = n.get<uint32_t>();
+      auto to   = n.get<uint32_t>();
+      auto res  = n.get<float>();
+      if(!n.good() || from >= nodes.size() || to >= nodes.size()) {
+        good = false;
+        return;
+      }
+      auto& edge = rct._edges.emplace_back(*nodes[from], *nodes[to], res);
+      nodes[from]->_fanout.push_back(&edge);
+      nodes[to]->_fanin.push_back(&edge);
+    }
+
+    if(!n.good()) {
+      good = false;
+      return;
+    }
+
+    net._spef_hash = has_hash ? std::optional<size_t>(hash) : std::nullopt;
+    net._rc_timing_updated = false;
+  });
+
+  libraries.precede(verilog);
+  verilog.precede(rctrees);
+
+  sf.join();
+
+  if(!good) {
+    return false;
+  }
+
+  // Step 5: constraints, clocks and cppr
+  for(const auto& [name, values] : constraints) {
+
+    using Values = TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN>;
+
+    std::array<Values, 2> v;
+    std::memcpy(v.data(), values.data(), sizeof(v));
+
+    if(auto pi = _pis.find(std::string(name)); pi != _pis.end()) {
+      FOR_EACH_EL_RF(el, rf) {
+        _set_at(pi->second, el, rf, v[0][el][rf]);
+        _set_slew(pi->second, el, rf, v[1][el][rf]);
+      }
+    }
+    else if(auto po = _pos.find(std::string(name)); po != _pos.end()) {
+      FOR_EACH_EL_RF(el, rf) {
+        _set_rat(po->second, el, rf, v[0][el][rf]);
+        _set_load(po->second, el, rf, v[1][el][rf]);
+      }
+    }
+    else {
+      return false;
+    }
+  }
+
+  for(const auto& [name, source, period, waveform] : clocks) {
+    if(source.empty()) {
+      _create_clock(std::string(name), period)._waveform = waveform;
+    }
+    else if(auto itr = _pins.find(std::string(source)); itr != _pins.end()) {
+      _create_clock(std::string(name), itr->second, period)._waveform = waveform;
+    }
+    else {
+      return false;
+    }
+  }
+
+  _cppr(cppr);
+
+  return true;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
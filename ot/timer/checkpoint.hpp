@@ -0,0 +1,119 @@
+#ifndef OT_TIMER_CHECKPOINT_HPP_
+#define OT_TIMER_CHECKPOINT_HPP_
+
+#include <ot/headerdef.hpp>
+
+namespace ot {
+
+// Class: Checkpoint
+// A binary image of the design held by a timer: units, library paths, ports, nets, gates and
+// their pin-to-net connections, the rc tree of each net, port constraints, clocks and cppr.
+// The derived objects (arcs, tests, sccs, endpoints) are rebuilt from the gates on restore.
+//
+// Layout (native byte order):
+//   Header | units | libraries | netlist | rctrees | constraints | clocks | cppr
+//
+// A number is stored as is and a string is its size (uint32_t) followed by its characters,
+// such that the strings of a mapped checkpoint are read in place. Each rc tree record is
+// prefixed by its size to restore the rc trees in parallel.
+class Checkpoint {
+
+  public:
+
+    constexpr static char MAGIC[8] = {'O', 'T', 'C', 'K', 'P', 'T', 'B', '\n'};
+    constexpr static uint32_t VERSION = 1;
+    constexpr static uint32_t ORDER_MARK = 0x01020304;
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t byte_order;
+      uint64_t size;
+    };
+
+    // Class: Writer
+    class Writer {
+
+      public:
+
+        Writer(std::ostream&);
+
+        template <typename T>
+        void put(const T&);
+
+        void put(std::string_view);
+
+      private:
+
+        std::ostream& _os;
+    };
+
+    // Class: Reader
+    class Reader {
+
+      public:
+
+        Reader(std::string_view);
+
+        template <typename T>
+        T get();
+
+        std::string_view get_string();
+        std::string_view get_bytes(size_t);
+
+        size_t get_count();
+
+        inline bool good() const;
+        inline size_t offset() const;
+
+      private:
+
+        std::string_view _data;
+
+        size_t _offset {0};
+
+        bool _good {true};
+    };
+};
+
+// Procedure: put
+// Write a number (or an array of numbers) as is.
+template <typename T>
+void Checkpoint::Writer::put(const T& v) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  _os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+// Function: get
+// Read a number; a read past the end gives zero and fails the reader.
+template <typename T>
+T Checkpoint::Reader::get() {
+
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  T v {};
+
+  if(!_good || _offset + sizeof(T) > _data.size()) {
+    _good = false;
+  }
+  else {
+    std::memcpy(&v, _data.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+  }
+
+  return v;
+}
+
+// Function: good
+inline bool Checkpoint::Reader::good() const {
+  return _good;
+}
+
+// Function: offset
+inline size_t Checkpoint::Reader::offset() const {
+  return _offset;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
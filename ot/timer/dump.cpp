@@ -9,8 +9,10 @@ void Timer::dump_graph(std::ostream& os) const {
 }
 
 // Function: dump_power
-void Timer::dump_power(std::ostream& os) const {
-  std::shared_lock lock(_mutex);
+// The internal power of the cell arcs is evaluated on demand at the current slews and loads.
+void Timer::dump_power(std::ostream& os) {
+  std::scoped_lock lock(_mutex);
+  _update_ipower();
   _dump_power(os);
 }
 
@@ -531,7 +533,7 @@ void Timer::_dump_rctree(std::ostream& os) const {
        << rct->_root->_name  << '\n';
 
     for(const auto& [node_name, node] : rct->_nodes) {
-      os << node_name << ' ' << node._ncap[MIN][RISE] << '\n';
+      os << net._node_name(node_name) << ' ' << node._ncap[MIN][RISE] << '\n';
 
       //os << "ures:";
       //FOR_EACH_EL_RF(el, rf) {
@@ -571,7 +573,9 @@ void Timer::_dump_rctree(std::ostream& os) const {
     }
 
     for(const auto& edge : rct->_edges) {
-      os << edge._from._name << ' ' << edge._to._name << ' ' << edge._res << '\n';
+      os << net._node_name(edge._from._name) << ' ' 
+         << net._node_name(edge._to._name) << ' ' 
+         << edge._res << '\n';
     }
   }
 
@@ -668,7 +672,8 @@ void Timer::_dump_spef(std::ostream& os) const {
       // *CAP section
       os << "*CAP\n";
       for(const auto& node : rct->_nodes) {
-        os << ++idx << ' ' << node.first << ' ' << node.second._ncap[MIN][RISE] << '\n';
+        os << ++idx << ' ' << net._node_name(node.first) << ' ' 
+           << node.second._ncap[MIN][RISE] << '\n';
       }
 
       // *RES section
@@ -678,8 +683,8 @@ void Timer::_dump_spef(std::ostream& os) const {
         ++idx;
         if(idx & 1) {
           os << idx << ' '
-             << edge._from._name << ' '
-             << edge._to._name << ' '
+             << net._node_name(edge._from._name) << ' '
+             << net._node_name(edge._to._name) << ' '
              << edge._res << '\n';
         }
       }
@@ -0,0 +1,217 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Function: apply_ecos
+// Apply a batch of edits as one operation. The edits are grouped by the gates and nets they
+// touch: the edits of a group are applied in order, and the groups of in-place repowers (see
+// Timer::repower_gate) are applied concurrently.
+Timer& Timer::apply_ecos(std::vector<Eco> ecos) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto task = _taskflow.emplace([this, ecos=std::move(ecos)] (tf::Subflow& sf) {
+    _apply_ecos(ecos, sf);
+  });
+
+  _add_to_lineage(task, true);
+
+  return *this;
+}
+
+// Procedure: _apply_ecos
+void Timer::_apply_ecos(const std::vector<Eco>& ecos, tf::Subflow& sf) {
+
+  // the undo log of a transaction is written in order
+  if(_transaction) {
+    for(const auto& eco : ecos) {
+      _apply_eco(eco);
+    }
+    return;
+  }
+
+  // Step 1: group the edits by the gates and nets they touch (union-find over the edits),
+  // where a gate edit touches the nets of the gate and a pin edit touches the gate of the pin
+  std::vector<size_t> parent(ecos.size());
+  std::unordered_map<std::string, size_t> owners;
+
+  std::iota(parent.begin(), parent.end(), 0);
+
+  auto find = [&] (size_t i) {
+    while(parent[i] != i) {
+      i = parent[i] = parent[parent[i]];
+    }
+    return i;
+  };
+
+  auto touch = [&] (size_t i, std::string key) {
+    if(auto [itr, inserted] = owners.try_emplace(std::move(key), i); !inserted) {
+      parent[find(i)] = find(itr->second);
+    }
+  };
+
+  auto touch_gate = [&] (size_t i, const std::string& name) {
+    touch(i, "g:" + name);
+    if(auto itr = _gates.find(name); itr != _gates.end()) {
+      for(auto pin : itr->second._pins) {
+        if(pin->_net) {
+          touch(i, "n:" + pin->_net->_name);
+        }
+      }
+    }
+  };
+
+  auto touch_pin = [&] (size_t i, const std::string& name) {
+    if(auto itr = _pins.find(name); itr == _pins.end()) {
+      touch(i, "p:" + name);
+    }
+    else {
+      auto& pin = itr->second;
+      touch(i, pin._gate ? "g:" + pin._gate->_name : "p:" + name);
+      if(pin._net) {
+        touch(i, "n:" + pin._net->_name);
+      }
+    }
+  };
+
+  auto touch_net = [&] (size_t i, const std::string& name) {
+    touch(i, "n:" + name);
+    if(auto itr = _nets.find(name); itr != _nets.end()) {
+      for(auto pin : itr->second._pins) {
+        touch(i, pin->_gate ? "g:" + pin->_gate->_name : "p:" + pin->_name);
+      }
+    }
+  };
+
+  for(size_t i=0; i<ecos.size(); ++i) {
+    std::visit(Functors{
+      [&] (const InsertGate& e)    { touch(i, "g:" + e.gate); },
+      [&] (const RemoveGate& e)    { touch_gate(i, e.gate); },
+      [&] (const RepowerGate& e)   { touch_gate(i, e.gate); },
+      [&] (const InsertNet& e)     { touch(i, "n:" + e.net); },
+      [&] (const RemoveNet& e)     { touch_net(i, e.net); },
+      [&] (const ConnectPin& e)    { touch_pin(i, e.pin); touch(i, "n:" + e.net); },
+      [&] (const DisconnectPin& e) { touch_pin(i, e.pin); }
+    }, ecos[i]);
+  }
+
+  // Step 2: collect the edits of each group in order
+  std::vector<std::vector<size_t>> groups;
+  std::unordered_map<size_t, size_t> gids;
+
+  for(size_t i=0; i<ecos.size(); ++i) {
+    auto [itr, inserted] = gids.try_emplace(find(i), groups.size());
+    if(inserted) {
+      groups.emplace_back();
+    }
+    groups[itr->second].push_back(i);
+  }
+
+  // Step 3: apply the groups of repowers concurrently, each up to its first edit that can't be
+  // done in place; the group touches only its gates, pins and nets.
+  std::vector<size_t> applied(groups.size(), 0);
+  std::vector<std::vector<Pin*>> frontiers(groups.size());
+
+  sf.for_each_index(size_t{0}, groups.size(), size_t{1}, [&] (size_t g) {
+    for(auto i : groups[g]) {
+
+      auto e = std::get_if<RepowerGate>(&ecos[i]);
+
+      if(e == nullptr || !_celllib[MIN] || !_celllib[MAX]) {
+        break;
+      }
+
+      auto gitr = _gates.find(e->gate);
+      auto cell = CellView {_celllib[MIN]->cell(e->cell), _celllib[MAX]->cell(e->cell)};
+
+      if(gitr == _gates.end() || !cell[MIN] || !cell[MAX]) {
+        break;
+      }
+
+      auto& gate = gitr->second;
+      auto tvs = _isomorphic_timing_views(gate, cell);
+
+      if(!tvs) {
+        break;
+      }
+
+      _remap_gate(gate, cell, *tvs);
+
+      for(auto pin : gate._pins) {
+        frontiers[g].push_back(&_remap_frontier(*pin));
+      }
+
+      ++applied[g];
+    }
+  });
+
+  sf.join();
+
+  // Step 4: apply the remaining edits of each group in order
+  size_t num_parallel {0};
+
+  for(size_t g=0; g<groups.size(); ++g) {
+
+    for(auto pin : frontiers[g]) {
+      _insert_frontier(*pin);
+    }
+
+    num_parallel += applied[g];
+
+    for(size_t k=applied[g]; k<groups[g].size(); ++k) {
+      _apply_eco(ecos[groups[g][k]]);
+    }
+  }
+
+  OT_LOGI(
+    "applied ", ecos.size(), " ecos in ", groups.size(), " groups (",
+    num_parallel, " repowered in place)"
+  );
+}
+
+// Procedure: _apply_eco
+void Timer::_apply_eco(const Eco& eco) {
+  std::visit(Functors{
+    [&] (const InsertGate& e) {
+      _record_gate(e.gate);
+      _insert_gate(e.gate, e.cell);
+    },
+    [&] (const RemoveGate& e) {
+      _record_gate(e.gate);
+      if(auto itr = _gates.find(e.gate); itr != _gates.end()) {
+        _remove_gate(itr->second);
+      }
+    },
+    [&] (const RepowerGate& e) {
+      _record_gate(e.gate);
+      _repower_gate(e.gate, e.cell);
+    },
+    [&] (const InsertNet& e) {
+      _record_insert_net(e.net);
+      _insert_net(e.net);
+    },
+    [&] (const RemoveNet& e) {
+      _record_remove_net(e.net);
+      if(auto itr = _nets.find(e.net); itr != _nets.end()) {
+        _remove_net(itr->second);
+      }
+    },
+    [&] (const ConnectPin& e) {
+      auto p = _pins.find(e.pin);
+      auto n = _nets.find(e.net);
+      OT_LOGE_RIF(p==_pins.end() || n == _nets.end(),
+        "can't connect pin ", e.pin,  " to net ", e.net, " (pin/net not found)"
+      )
+      _record_pin(e.pin, e.net);
+      _connect_pin(p->second, n->second);
+    },
+    [&] (const DisconnectPin& e) {
+      _record_pin(e.pin);
+      if(auto itr = _pins.find(e.pin); itr != _pins.end()) {
+        _disconnect_pin(itr->second);
+      }
+    }
+  }, eco);
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
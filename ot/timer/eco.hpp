@@ -0,0 +1,55 @@
+#ifndef OT_TIMER_ECO_HPP_
+#define OT_TIMER_ECO_HPP_
+
+#include <ot/headerdef.hpp>
+
+namespace ot {
+
+// Struct: InsertGate
+struct InsertGate {
+  std::string gate;
+  std::string cell;
+};
+
+// Struct: RemoveGate
+struct RemoveGate {
+  std::string gate;
+};
+
+// Struct: RepowerGate
+struct RepowerGate {
+  std::string gate;
+  std::string cell;
+};
+
+// Struct: InsertNet
+struct InsertNet {
+  std::string net;
+};
+
+// Struct: RemoveNet
+struct RemoveNet {
+  std::string net;
+};
+
+// Struct: ConnectPin
+struct ConnectPin {
+  std::string pin;
+  std::string net;
+};
+
+// Struct: DisconnectPin
+struct DisconnectPin {
+  std::string pin;
+};
+
+// Type: Eco
+// An edit of the design, the same as the builder of the same name (e.g., RepowerGate for
+// Timer::repower_gate), to apply in a batch through Timer::apply_ecos.
+using Eco = std::variant<
+  InsertGate, RemoveGate, RepowerGate, InsertNet, RemoveNet, ConnectPin, DisconnectPin
+>;
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
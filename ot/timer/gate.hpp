@@ -2,6 +2,7 @@
 #define OT_TIMER_GATE_HPP_
 
 #include <ot/liberty/celllib.hpp>
+#include <ot/timer/power.hpp>
 
 namespace ot {
 
@@ -35,6 +36,8 @@ class Gate {
     std::vector<Arc*> _arcs;
     std::vector<Test*> _tests;
 
+    Power _power;
+
     //void _repower(CellView);
 }; 
 
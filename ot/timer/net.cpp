@@ -238,10 +238,59 @@ Net::Net(const std::string& name) :
 }
 
 // Procedure: _attach
-void Net::_attach(spef::Net&& spef_net) {
+// Returns false if the parasitics are identical to the ones already attached, in which case
+// the net is left untouched and its timing remains valid.
+bool Net::_attach(spef::Net&& spef_net) {
+
   assert(spef_net.name == _name && _root);
+
+  if(auto h = _hash(spef_net); h == _spef_hash) {
+    return false;
+  }
+  else {
+    _spef_hash = h;
+  }
+
   _spef_net = std::move(spef_net);
   _rc_timing_updated = false;
+
+  return true;
+}
+
+// Function: _hash
+// Content hash of the parasitics of a spef net.
+size_t Net::_hash(const spef::Net& net) {
+
+  size_t seed {0};
+
+  auto combine = [&seed] (const auto& v) {
+    seed ^= std::hash<std::decay_t<decltype(v)>>{}(v) + 0x9e3779b97f4a7c15 + (seed<<6) + (seed>>2);
+  };
+
+  combine(net.name);
+  combine(net.lcap);
+
+  for(const auto& c : net.connections) {
+    combine(c.name);
+    combine(static_cast<int>(c.type));
+    combine(static_cast<int>(c.direction));
+    combine(c.load.value_or(0.0f));
+    combine(c.driving_cell);
+  }
+
+  for(const auto& [node1, node2, cap] : net.caps) {
+    combine(node1);
+    combine(node2);
+    combine(cap);
+  }
+
+  for(const auto& [node1, node2, res] : net.ress) {
+    combine(node1);
+    combine(node2);
+    combine(res);
+  }
+
+  return seed;
 }
 
 // Procedure: _make_rct
@@ -284,6 +333,8 @@ void Net::_scale_capacitance(float s) {
     }
   }, _rct);
   
+  // the parasitics no longer match the hash of the spef net
+  _spef_hash.reset();
   _rc_timing_updated = false;
 }
 
@@ -299,6 +350,8 @@ void Net::_scale_resistance(float s) {
     }
   }, _rct);
   
+  // the parasitics no longer match the hash of the spef net
+  _spef_hash.reset();
   _rc_timing_updated = false;
 }
 
@@ -424,6 +477,16 @@ std::optional<float> Net::_slew(Split m, Tran t, float si, Pin& to) const {
   }, _rct);
 }
 
+// Function: _node_name
+// Materialize the full name of a rctree node. Internal nodes are kept relative to the net
+// (see spef::Spef::localize_name) and start with the spef delimiter.
+std::string Net::_node_name(const std::string& node) const {
+  if(!node.empty() && std::strchr(".:/|", node.front()) != nullptr) {
+    return _name + node;
+  }
+  return node;
+}
+
 // Function: _delay
 // Query the slew at the given pin through this net.
 std::optional<float> Net::_delay(Split m, Tran t, Pin& to) const {
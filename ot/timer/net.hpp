@@ -173,21 +173,29 @@ class Net {
 
     std::optional<spef::Net> _spef_net;
 
+    std::optional<size_t> _spef_hash;
+
     bool _rc_timing_updated {false};
 
+    Power _power;
+
     float _load(Split, Tran) const;
 
     std::optional<float> _slew(Split, Tran, float, Pin&) const;
     std::optional<float> _delay(Split, Tran, Pin&) const;
+
+    std::string _node_name(const std::string&) const;
     
     void _update_rc_timing();
-    void _attach(spef::Net&&);
+    bool _attach(spef::Net&&);
     void _make_rct();
     //void _make_rct(const spef::Net&);
     void _insert_pin(Pin&);
     void _remove_pin(Pin&);
     void _scale_capacitance(float);
     void _scale_resistance(float);
+
+    static size_t _hash(const spef::Net&);
 }; 
 
 // Function: name
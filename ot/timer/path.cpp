@@ -484,7 +484,7 @@ void Timer::_recover_datapath(Path& path, const SfxtCache& sfxt) const {
     std::tie(upin, urf) = _decode_pin(u);
     assert(path.back().transition == frf && urf == trf);
     auto at = path.back().at + *arc->_delay[sfxt._el][frf][trf];
-    auto ip = *arc->_ipower[sfxt._el][frf][trf];
+    auto ip = arc->_eval_ipower(sfxt._el, frf, trf).value_or(0.0f);
     path.emplace_back(*upin, urf, at, ip);
   }
 }
@@ -513,7 +513,7 @@ void Timer::_recover_datapath(
   else {
     assert(!path.empty());
     auto at = path.back().at + *node->arc->_delay[sfxt._el][path.back().transition][urf];
-    auto ip = *node->arc->_ipower[sfxt._el][path.back().transition][urf];
+    auto ip = node->arc->_eval_ipower(sfxt._el, path.back().transition, urf).value_or(0.0f);
     path.emplace_back(*upin, urf, at, ip);
   }
 
@@ -524,7 +524,7 @@ void Timer::_recover_datapath(
     std::tie(upin, urf) = _decode_pin(u);
     assert(path.back().transition == frf && urf == trf);
     auto at = path.back().at + *arc->_delay[sfxt._el][frf][trf]; 
-    auto ip = *arc->_ipower[sfxt._el][frf][trf];
+    auto ip = arc->_eval_ipower(sfxt._el, frf, trf).value_or(0.0f);
     path.emplace_back(*upin, urf, at, ip);
   }
 
@@ -54,6 +54,10 @@ void PrimaryInput::_scale_time(float s) {
       _at[el][rf] = _at[el][rf].value() * s;
     }
   }
+
+  if(_activity) {
+    _activity->toggle_rate /= s;
+  }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -259,9 +263,13 @@ std::pair<float,float> Pin::power() const {
   int   pin_total_num = 0;
   for(const auto& arc : _fanout) {
 
+    if(!arc->_ipower) {
+      continue;
+    }
+
     FOR_EACH_EL_RF(el, rf) {
-      if (arc->_ipower[el][rf][rf] ) {
-        auto pw = *arc->_ipower[el][rf][rf];
+      if (const auto& ip = (*arc->_ipower)[el][rf][rf]; ip) {
+        auto pw = *ip;
         // os << "  \"" << arc->_from._name << "\" -> \"" << arc->_to._name << " power:" << pw << "\n";
         pin_total_ipower += pw;
         pin_total_num++;
@@ -2,6 +2,7 @@
 #define OT_TIMER_PIN_HPP_
 
 #include <ot/liberty/celllib.hpp>
+#include <ot/timer/power.hpp>
 
 namespace ot {
 
@@ -34,6 +35,8 @@ class PrimaryInput {
     TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> _slew;
     TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> _at;
 
+    std::optional<Activity> _activity;
+
     void _scale_time(float s);
     void _scale_capacitance(float s);
 };
@@ -120,6 +123,7 @@ class Pin {
   constexpr static int IN_BPROP_STACK   = 0x08;
   constexpr static int UNLOOP_CAND      = 0x10;
   constexpr static int IN_UNLOOP_STACK  = 0x20;
+  constexpr static int FPROP_BOUND      = 0x40;
 
   public:
     
@@ -168,11 +172,14 @@ class Pin {
 
     std::optional<std::list<Pin*>::iterator> _frontier_satellite;
     std::optional<std::list<Pin*>::iterator> _net_satellite;
+    std::optional<std::list<Pin*>::iterator> _deferred_satellite;
 
     TimingData<std::optional<Slew>, MAX_SPLIT, MAX_TRAN> _slew;
     TimingData<std::optional<Rat >, MAX_SPLIT, MAX_TRAN> _rat;
     TimingData<std::optional<At  >, MAX_SPLIT, MAX_TRAN> _at;
 
+    std::optional<Activity> _activity;
+
     int _state {0};
 
     std::optional<tf::Task> _ftask;
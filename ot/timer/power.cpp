@@ -0,0 +1,478 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Operator: <<
+std::ostream& operator << (std::ostream& os, const Activity& activity) {
+  os << "toggle rate " << activity.toggle_rate
+     << " static probability " << activity.static_probability;
+  return os;
+}
+
+// Operator: <<
+std::ostream& operator << (std::ostream& os, const Power& power) {
+  os << "switching " << power.switching
+     << " internal " << power.internal
+     << " leakage " << power.leakage
+     << " total " << power.total();
+  return os;
+}
+
+// Function: propagate_activity
+// Propagate the activities of the variables through a function, assuming independent signals.
+// The static probability of the output is the probability of the on-set, and the toggle rate
+// of the output is the sum of the toggle rates of the variables, each weighted by the
+// probability of its boolean difference (i.e., the output is sensitive to the variable).
+Activity propagate_activity(const LogicFunction& func, const std::vector<Activity>& vars) {
+
+  assert(vars.size() == func.variables.size());
+
+  const auto n = vars.size();
+
+  // probability of the value of the j-th variable in an assignment
+  auto prob = [&] (size_t a, size_t j) {
+    return ((a >> j) & 1) ? vars[j].static_probability : 1.0f - vars[j].static_probability;
+  };
+
+  Activity activity {0.0f, 0.0f};
+
+  for(size_t a=0; a<func.truth_table.size(); ++a) {
+
+    if(func(a)) {
+      float p = 1.0f;
+      for(size_t j=0; j<n; ++j) {
+        p *= prob(a, j);
+      }
+      activity.static_probability += p;
+    }
+
+    // each pair of assignments differing in the i-th variable is visited once
+    for(size_t i=0; i<n; ++i) {
+
+      if(((a >> i) & 1) || func(a) == func(a | (size_t{1} << i))) {
+        continue;
+      }
+
+      float p = 1.0f;
+      for(size_t j=0; j<n; ++j) {
+        if(j != i) {
+          p *= prob(a, j);
+        }
+      }
+      activity.toggle_rate += p * vars[i].toggle_rate;
+    }
+  }
+
+  return activity;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Function: power_analysis
+// Enable/Disable the power analysis. The switching activity is propagated along with the
+// timing, and the power of each net and gate as well as the total power are updated
+// incrementally with the timing.
+Timer& Timer::power_analysis(bool flag) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto op = _taskflow.emplace([this, flag] () {
+    _power(flag);
+  });
+
+  _add_to_lineage(op);
+
+  return *this;
+}
+
+// Procedure: _power
+void Timer::_power(bool enable) {
+
+  // nothing to do.
+  if(enable == _power_analysis.has_value()) {
+    return;
+  }
+
+  if(enable) {
+
+    _power_analysis.emplace();
+
+    for(auto& kvp : _gates) {
+      kvp.second._power = Power{};
+    }
+
+    for(auto& kvp : _nets) {
+      kvp.second._power = Power{};
+    }
+
+    _enable_full_timing_update();
+  }
+  else {
+    _power_analysis.reset();
+  }
+}
+
+// Function: set_switching_activity
+// Set the switching activity of a primary input. A primary input without the activity
+// switches at the rate of its clock if it is a clock source or at the default activity
+// otherwise (see set_default_switching_activity).
+Timer& Timer::set_switching_activity(std::string name, std::optional<Activity> activity) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto op = _taskflow.emplace([this, name=std::move(name), activity] () {
+    if(auto itr = _pis.find(name); itr != _pis.end()) {
+      _record_port(name);
+      _set_switching_activity(itr->second, activity);
+    }
+    else {
+      OT_LOGE("can't set switching activity (PI ", name, " not found)");
+    }
+  });
+
+  _add_to_lineage(op, true);
+
+  return *this;
+}
+
+// Procedure: _set_switching_activity
+void Timer::_set_switching_activity(PrimaryInput& pi, std::optional<Activity> activity) {
+  pi._activity = activity;
+  _insert_frontier(pi._pin);
+}
+
+// Function: set_default_switching_activity
+// Set the activity of the primary inputs without any activity set and of the sequential
+// outputs. By default, a signal toggles at one tenth of the clock rate (twice per period)
+// with the static probability of 0.5.
+Timer& Timer::set_default_switching_activity(std::optional<Activity> activity) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto op = _taskflow.emplace([this, activity] () {
+    _default_activity = activity;
+    _enable_full_timing_update();
+  });
+
+  _add_to_lineage(op);
+
+  return *this;
+}
+
+// Function: report_power
+// Report the total power of the design (requires the power analysis).
+std::optional<Power> Timer::report_power() {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  if(!_power_analysis) {
+    OT_LOGW("power analysis is disabled");
+    return std::nullopt;
+  }
+
+  return Power {
+    static_cast<float>(_power_analysis->switching),
+    static_cast<float>(_power_analysis->internal),
+    static_cast<float>(_power_analysis->leakage)
+  };
+}
+
+// Function: report_gate_power
+// Report the internal and leakage power of a gate (requires the power analysis).
+std::optional<Power> Timer::report_gate_power(const std::string& name) {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  if(auto itr = _gates.find(name); _power_analysis && itr != _gates.end()) {
+    return itr->second._power;
+  }
+
+  return std::nullopt;
+}
+
+// Function: report_net_power
+// Report the switching power of a net (requires the power analysis).
+std::optional<Power> Timer::report_net_power(const std::string& name) {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  if(auto itr = _nets.find(name); _power_analysis && itr != _nets.end()) {
+    return itr->second._power;
+  }
+
+  return std::nullopt;
+}
+
+// Function: report_switching_activity
+// Report the switching activity of a pin (requires the power analysis).
+std::optional<Activity> Timer::report_switching_activity(const std::string& name) {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  if(auto itr = _pins.find(name); _power_analysis && itr != _pins.end()) {
+    return itr->second._activity;
+  }
+
+  return std::nullopt;
+}
+
+// Function: _default_switching_activity
+Activity Timer::_default_switching_activity() const {
+
+  if(_default_activity) {
+    return *_default_activity;
+  }
+
+  // TODO: currently we assume a single clock...
+  if(!_clocks.empty() && _clocks.begin()->second._period > 0.0f) {
+    return Activity {0.2f / _clocks.begin()->second._period, 0.5f};
+  }
+
+  return Activity {0.0f, 0.5f};
+}
+
+// Function: _input_activity
+Activity Timer::_input_activity(const PrimaryInput& pi) const {
+
+  if(pi._activity) {
+    return *pi._activity;
+  }
+
+  for(const auto& kvp : _clocks) {
+    if(const auto& clock = kvp.second; clock._source == &pi._pin && clock._period > 0.0f) {
+      return Activity {2.0f / clock._period, 0.5f};
+    }
+  }
+
+  return _default_switching_activity();
+}
+
+// Function: _output_activity
+// The activity of a cell output pin. The activity is propagated through the function of
+// the output if every variable of the function is a related pin of the output. Otherwise,
+// a sequential output switches at the default activity, and any other output switches at
+// the highest toggle rate of its related pins.
+std::optional<Activity> Timer::_output_activity(const Pin& pin) const {
+
+  // the related pins of the cell arcs to the pin
+  std::vector<const Pin*> inputs;
+
+  for(auto arc : pin._fanin) {
+    if(!arc->is_cell_arc() || arc->_has_state(Arc::LOOP_BREAKER) || !arc->_from._activity) {
+      continue;
+    }
+    if(std::find(inputs.begin(), inputs.end(), &arc->_from) == inputs.end()) {
+      inputs.push_back(&arc->_from);
+    }
+  }
+
+  if(const auto& func = pin.cellpin(MIN)->logic_function; func) {
+
+    std::vector<Activity> vars;
+
+    for(const auto& v : func->variables) {
+      auto itr = std::find_if(inputs.begin(), inputs.end(), [&] (auto in) {
+        return in->cellpin(MIN)->name == v;
+      });
+      if(itr == inputs.end()) {
+        break;
+      }
+      vars.push_back(*(*itr)->_activity);
+    }
+
+    if(vars.size() == func->variables.size()) {
+      return propagate_activity(*func, vars);
+    }
+  }
+
+  if(!pin._gate->_tests.empty()) {
+    return _default_switching_activity();
+  }
+
+  std::optional<Activity> activity;
+
+  for(auto in : inputs) {
+    if(!activity || in->_activity->toggle_rate > activity->toggle_rate) {
+      activity = Activity {in->_activity->toggle_rate, 0.5f};
+    }
+  }
+
+  return activity;
+}
+
+// Procedure: _fprop_activity
+// Propagate the switching activity to a pin: a primary input from its assertion, a net sink
+// from the root of the net, and a cell output from its related pins.
+void Timer::_fprop_activity(Pin& pin) {
+
+  pin._activity.reset();
+
+  // PI
+  if(auto pi = pin.primary_input(); pi) {
+    pin._activity = _input_activity(*pi);
+    return;
+  }
+
+  for(auto arc : pin._fanin) {
+    if(arc->is_net_arc() && !arc->_has_state(Arc::LOOP_BREAKER)) {
+      pin._activity = arc->_from._activity;
+      return;
+    }
+  }
+
+  if(pin._gate && pin.is_output()) {
+    pin._activity = _output_activity(pin);
+  }
+}
+
+// Function: _power_scale
+// The factor that converts an energy in the capacitance and voltage units per time unit to
+// the power unit.
+float Timer::_power_scale() const {
+
+  if(!_capacitance_unit || !_voltage_unit || !_time_unit || !_power_unit) {
+    return 1.0f;
+  }
+
+  return (*_capacitance_unit * *_voltage_unit * *_voltage_unit / *_time_unit / *_power_unit).value();
+}
+
+// Function: _gate_power
+// The internal power of a gate is the energy of a transition at each output (averaged over
+// the timing arcs and transitions to the output) times the toggle rate of the output, and
+// the leakage power is the leakage power of the cell.
+Power Timer::_gate_power(const Gate& gate, float scale) const {
+
+  Power power;
+
+  if(const auto& cell = gate._cell[MIN]; cell->leakage_power) {
+    power.leakage = *cell->leakage_power;
+  }
+  else if(_celllib[MIN] && _celllib[MIN]->default_cell_leakage_power) {
+    power.leakage = *_celllib[MIN]->default_cell_leakage_power;
+  }
+
+  for(auto pin : gate._pins) {
+
+    // a net yet to update is updated (and the gate with it) in the next propagation
+    if(!pin->_activity || (pin->_net && !pin->_net->_rc_timing_updated)) {
+      continue;
+    }
+
+    float energy {0.0f};
+    size_t num {0};
+
+    for(auto arc : pin->_fanin) {
+      if(!arc->is_cell_arc()) {
+        continue;
+      }
+      FOR_EACH_EL_RF_RF_IF(el, frf, trf, arc->_delay[el][frf][trf]) {
+        if(auto e = arc->_eval_ipower(el, frf, trf); e) {
+          energy += *e;
+          ++num;
+        }
+      }
+    }
+
+    if(num) {
+      power.internal += energy / num * pin->_activity->toggle_rate * scale;
+    }
+  }
+
+  return power;
+}
+
+// Function: _net_power
+// The switching power of a net is the energy to charge the load at each transition of the
+// root (half the load times the squared voltage) times the toggle rate of the root.
+Power Timer::_net_power(const Net& net, float scale) const {
+
+  Power power;
+
+  if(!net._root || !net._root->_activity || !net._rc_timing_updated) {
+    return power;
+  }
+
+  float load {0.0f};
+
+  FOR_EACH_EL_RF(el, rf) {
+    load += net._load(el, rf);
+  }
+
+  load /= (MAX_SPLIT * MAX_TRAN);
+
+  auto v = cell_voltage().value_or(1.0f);
+
+  power.switching = 0.5f * load * v * v * net._root->_activity->toggle_rate * scale;
+
+  return power;
+}
+
+// Procedure: _update_power
+// Update the power of the gates and the nets of the given pins in parallel, and then the
+// total power by the changes.
+void Timer::_update_power(const std::deque<Pin*>& pins) {
+
+  std::vector<Gate*> gates;
+  std::vector<Net*> nets;
+  std::unordered_set<Gate*> visited;
+
+  for(auto pin : pins) {
+    if(pin->_gate && visited.insert(pin->_gate).second) {
+      gates.push_back(pin->_gate);
+    }
+    // the power of a net changes with its root only
+    if(pin->_net && pin->_net->_root == pin) {
+      nets.push_back(pin->_net);
+    }
+  }
+
+  std::vector<Power> gpower(gates.size());
+  std::vector<Power> npower(nets.size());
+
+  auto scale = _power_scale();
+
+  _taskflow.for_each_index(size_t{0}, gates.size(), size_t{1}, [&] (size_t i) {
+    gpower[i] = _gate_power(*gates[i], scale);
+  });
+
+  _taskflow.for_each_index(size_t{0}, nets.size(), size_t{1}, [&] (size_t i) {
+    npower[i] = _net_power(*nets[i], scale);
+  });
+
+  _executor.run(_taskflow).wait();
+  _taskflow.clear();
+
+  for(size_t i=0; i<gates.size(); ++i) {
+    _replace_power(gates[i]->_power, gpower[i]);
+  }
+
+  for(size_t i=0; i<nets.size(); ++i) {
+    _replace_power(nets[i]->_power, npower[i]);
+  }
+}
+
+// Procedure: _replace_power
+// Replace the power of a gate or a net and update the total power by the change.
+void Timer::_replace_power(Power& power, const Power& value) {
+
+  if(!_power_analysis) {
+    return;
+  }
+
+  _power_analysis->switching += value.switching - power.switching;
+  _power_analysis->internal  += value.internal  - power.internal;
+  _power_analysis->leakage   += value.leakage   - power.leakage;
+
+  power = value;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
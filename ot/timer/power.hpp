@@ -0,0 +1,53 @@
+#ifndef OT_TIMER_POWER_HPP_
+#define OT_TIMER_POWER_HPP_
+
+#include <ot/liberty/function.hpp>
+
+namespace ot {
+
+// Struct: Activity
+// The switching activity of a signal: the toggle rate (the expected number of transitions per
+// time unit) and the static probability (the probability of the signal being logic one).
+struct Activity {
+  float toggle_rate {0.0f};
+  float static_probability {0.5f};
+};
+
+std::ostream& operator << (std::ostream&, const Activity&);
+
+Activity propagate_activity(const LogicFunction&, const std::vector<Activity>&);
+
+// ------------------------------------------------------------------------------------------------
+
+// Struct: Power
+// The switching, internal and leakage power of a net, a gate or the design.
+struct Power {
+
+  float switching {0.0f};
+  float internal  {0.0f};
+  float leakage   {0.0f};
+
+  inline float total() const;
+};
+
+// Function: total
+inline float Power::total() const {
+  return switching + internal + leakage;
+}
+
+std::ostream& operator << (std::ostream&, const Power&);
+
+// ------------------------------------------------------------------------------------------------
+
+// Struct: PowerAnalysis
+// The total power of the design, maintained by the changes of the power of the gates and nets
+// (accumulated in double precision).
+struct PowerAnalysis {
+  double switching {0.0};
+  double internal  {0.0};
+  double leakage   {0.0};
+};
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -58,9 +58,11 @@ void Timer::_read_sdc(sdc::SetInputDelay& obj) {
     },
     [&] (sdc::GetPorts& get_ports) {
       for(auto& port : get_ports.ports) {
-        if(auto itr = _pis.find(port); itr != _pis.end()) {
-          FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
-            _set_at(itr->second, el, rf, obj.delay_value); 
+        if(auto pis = _find(_pis, _pi_names, port, get_ports.regexp); !pis.empty()) {
+          for(auto pi : pis) {
+            FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
+              _set_at(*pi, el, rf, obj.delay_value); 
+            }
           }
         }
         else {
@@ -68,8 +70,8 @@ void Timer::_read_sdc(sdc::SetInputDelay& obj) {
         }
       }
     },
-    [] (auto&&) {
-      assert(false);
+    [&] (auto&&) {
+      OT_LOGE(obj.command, ": unsupported object (expect ports)");
     }
   }, *obj.port_pin_list);
 }
@@ -92,9 +94,11 @@ void Timer::_read_sdc(sdc::SetInputTransition& obj) {
     },
     [&] (sdc::GetPorts& get_ports) {
       for(auto& port : get_ports.ports) {
-        if(auto itr = _pis.find(port); itr != _pis.end()) {
-          FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
-            _set_slew(itr->second, el, rf, obj.transition); 
+        if(auto pis = _find(_pis, _pi_names, port, get_ports.regexp); !pis.empty()) {
+          for(auto pi : pis) {
+            FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
+              _set_slew(*pi, el, rf, obj.transition); 
+            }
           }
         }
         else {
@@ -102,8 +106,8 @@ void Timer::_read_sdc(sdc::SetInputTransition& obj) {
         }
       }
     },
-    [] (auto&&) {
-      assert(false);
+    [&] (auto&&) {
+      OT_LOGE(obj.command, ": unsupported object (expect ports)");
     }
   }, *obj.port_list);
 }
@@ -138,14 +142,16 @@ void Timer::_read_sdc(sdc::SetOutputDelay& obj) {
     },
     [&] (sdc::GetPorts& get_ports) {
       for(auto& port : get_ports.ports) {
-        if(auto itr = _pos.find(port); itr != _pos.end()) {
-          FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
-            _set_rat(
-              itr->second, 
-              el, 
-              rf, 
-              el == MIN ? -(*obj.delay_value) : clock._period - (*obj.delay_value)
-            ); 
+        if(auto pos = _find(_pos, _po_names, port, get_ports.regexp); !pos.empty()) {
+          for(auto po : pos) {
+            FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
+              _set_rat(
+                *po, 
+                el, 
+                rf, 
+                el == MIN ? -(*obj.delay_value) : clock._period - (*obj.delay_value)
+              ); 
+            }
           }
         }
         else {
@@ -153,8 +159,8 @@ void Timer::_read_sdc(sdc::SetOutputDelay& obj) {
         }
       }
     },
-    [] (auto&&) {
-      assert(false);
+    [&] (auto&&) {
+      OT_LOGE(obj.command, ": unsupported object (expect ports)");
     }
   }, *obj.port_pin_list);
 }
@@ -177,9 +183,11 @@ void Timer::_read_sdc(sdc::SetLoad& obj) {
     },
     [&] (sdc::GetPorts& get_ports) {
       for(auto& port : get_ports.ports) {
-        if(auto itr = _pos.find(port); itr != _pos.end()) {
-          FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
-            _set_load(itr->second, el, rf, obj.value); 
+        if(auto pos = _find(_pos, _po_names, port, get_ports.regexp); !pos.empty()) {
+          for(auto po : pos) {
+            FOR_EACH_EL_RF_IF(el, rf, (mask | el) && (mask | rf)) {
+              _set_load(*po, el, rf, obj.value); 
+            }
           }
         }
         else {
@@ -187,8 +195,8 @@ void Timer::_read_sdc(sdc::SetLoad& obj) {
         }
       }
     },
-    [] (auto&&) {
-      assert(false);
+    [&] (auto&&) {
+      OT_LOGE(obj.command, ": unsupported object (expect ports)");
     }
   }, *obj.objects);
 }
@@ -201,19 +209,27 @@ void Timer::_read_sdc(sdc::CreateClock& obj) {
   
   // create clock from given sources
   if(obj.port_pin_list) {
+    // a clock has a single source
+    auto create = [&] (const std::vector<std::string>& patterns, bool regexp) {
+      assert(patterns.size() == 1);
+      if(auto pins = _find(_pins, _pin_names, patterns.front(), regexp); pins.empty()) {
+        OT_LOGE(obj.command, ": source ", std::quoted(patterns.front()), " not found");
+      }
+      else {
+        OT_LOGW_IF(pins.size() > 1, obj.command, ": multiple sources match ", patterns.front());
+        _create_clock(obj.name, *pins.front(), *obj.period);
+      }
+    };
+
     std::visit(Functors{
       [&] (sdc::GetPorts& get_ports) {
-        auto& ports = get_ports.ports;
-        assert(ports.size() == 1);
-        if(auto itr = _pins.find(ports.front()); itr != _pins.end()) {
-          _create_clock(obj.name, itr->second, *obj.period);
-        }
-        else {
-          OT_LOGE(obj.command, ": port ", std::quoted(ports.front()), " not found");
-        }
+        create(get_ports.ports, get_ports.regexp);
+      },
+      [&] (sdc::GetPins& get_pins) {
+        create(get_pins.pins, get_pins.regexp);
       },
-      [] (auto&&) {
-        assert(false);
+      [&] (auto&&) {
+        OT_LOGE(obj.command, ": unsupported object (expect ports or pins)");
       }
     }, *obj.port_pin_list);
   }
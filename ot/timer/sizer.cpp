@@ -0,0 +1,217 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Function: size_gates
+// Slack-driven greedy gate sizing. Each iteration evaluates every interchangeable cell (see
+// report_equivalent_cells) of the gates with a negative late slack in parallel (see
+// what_if_repower), picks the best move of each gate, keeps the moves of gates that share no
+// nets, and commits them as one batch of repowers with a single incremental update. The
+// sizing stops when no move improves the slack, or when an iteration does not improve the
+// late total negative slack (whose moves are then reverted).
+SizerResult Timer::size_gates(size_t max_iterations) {
+
+  std::scoped_lock lock(_mutex);
+
+  SizerResult result;
+
+  // late total negative slack
+  auto tns = [this] () {
+    _update_endpoints();
+    std::optional<float> v;
+    FOR_EACH_RF_IF(rf, _tns[MAX][rf]) {
+      v = v.value_or(0.0f) + *_tns[MAX][rf];
+    }
+    return v;
+  };
+
+  // commit a batch of repowers as one lineage task (see apply_ecos)
+  auto commit = [this] (std::vector<Eco> ecos) {
+    auto task = _taskflow.emplace([this, ecos=std::move(ecos)] (tf::Subflow& sf) {
+      _apply_ecos(ecos, sf);
+    });
+    _add_to_lineage(task, true);
+  };
+
+  result.tns_before = tns();
+  result.tns_after = result.tns_before;
+
+  while(result.num_iterations < max_iterations && result.tns_after.value_or(0.0f) < 0.0f) {
+
+    auto moves = _sizing_moves();
+
+    if(moves.empty()) {
+      break;
+    }
+
+    std::vector<Eco> ecos, undos;
+
+    for(const auto& [gate, cell] : moves) {
+      undos.push_back(RepowerGate{gate->_name, gate->cell_name()});
+      ecos.push_back(RepowerGate{gate->_name, cell->name});
+    }
+
+    commit(std::move(ecos));
+
+    ++result.num_iterations;
+
+    if(auto v = tns(); v.value_or(0.0f) < result.tns_after.value_or(0.0f)) {
+      commit(std::move(undos));
+      tns();
+      break;
+    }
+    else {
+      result.num_moves += moves.size();
+      result.tns_after = v;
+    }
+  }
+
+  OT_LOGI(
+    "sized ", result.num_moves, " gates in ", result.num_iterations, " iterations (tns ",
+    result.tns_before.value_or(0.0f), " -> ", result.tns_after.value_or(0.0f), ")"
+  );
+
+  return result;
+}
+
+// Function: _sizing_moves
+// Find the moves of one sizing iteration on the up-to-date timing: the best interchangeable
+// cell of each gate with a negative late slack at an output pin, where the gain of a cell is
+// the estimated change of the worst late slack at the pins of the gate. A move must not
+// introduce an early violation, and the moves do not share any nets.
+std::vector<std::pair<Gate*, const Cell*>> Timer::_sizing_moves() {
+
+  std::vector<Gate*> gates;
+
+  for(auto& [name, gate] : _gates) {
+    for(auto pin : gate._pins) {
+      if(pin->is_output() && std::any_of(TRAN.begin(), TRAN.end(), [pin] (auto rf) {
+        auto slack = pin->slack(MAX, rf);
+        return slack && *slack < 0.0f;
+      })) {
+        gates.push_back(&gate);
+        break;
+      }
+    }
+  }
+
+  // the best cell of each gate and its gain
+  std::vector<std::pair<const Cell*, float>> best(gates.size(), {nullptr, 0.0f});
+
+  tf::Taskflow taskflow;
+
+  taskflow.for_each_index(size_t{0}, gates.size(), size_t{1}, [&] (size_t i) {
+
+    const auto& gate = *gates[i];
+
+    auto fp = _celllib[MAX] ? _celllib[MAX]->footprint(gate.cell_name()) : nullptr;
+
+    if(fp == nullptr) {
+      return;
+    }
+
+    // the worst late slack at the pins of the gate
+    auto worst = [&] (auto&& slack) {
+      auto w = std::numeric_limits<float>::max();
+      for(size_t p=0; p<gate._pins.size(); ++p) {
+        FOR_EACH_RF(rf) {
+          if(auto s = slack(p, rf); s) {
+            w = std::min(w, *s);
+          }
+        }
+      }
+      return w;
+    };
+
+    auto current = worst([&] (size_t p, Tran rf) {
+      return gate._pins[p]->slack(MAX, rf);
+    });
+
+    for(auto cell : fp->by_drive) {
+
+      if(cell->name == gate.cell_name()) {
+        continue;
+      }
+
+      auto e = _what_if_repower(gate._name, cell->name);
+
+      if(!e) {
+        continue;
+      }
+
+      // no new early violation
+      auto violated = false;
+
+      for(size_t p=0; p<gate._pins.size() && !violated; ++p) {
+        FOR_EACH_RF(rf) {
+          auto s = gate._pins[p]->slack(MIN, rf);
+          auto d = e->pins[p].slack[MIN][rf];
+          if(s && d && *s >= 0.0f && *s + *d < 0.0f) {
+            violated = true;
+          }
+        }
+      }
+
+      if(violated) {
+        continue;
+      }
+
+      auto gain = worst([&] (size_t p, Tran rf) -> std::optional<float> {
+        auto s = gate._pins[p]->slack(MAX, rf);
+        auto d = e->pins[p].slack[MAX][rf];
+        if(!s) {
+          return std::nullopt;
+        }
+        return *s + d.value_or(0.0f);
+      }) - current;
+
+      if(gain > best[i].second) {
+        best[i] = {cell, gain};
+      }
+    }
+  });
+
+  _executor.run(taskflow).wait();
+
+  // keep the best moves of gates that share no nets
+  std::vector<size_t> order;
+
+  for(size_t i=0; i<gates.size(); ++i) {
+    if(best[i].first && best[i].second > std::numeric_limits<float>::epsilon()) {
+      order.push_back(i);
+    }
+  }
+
+  std::sort(order.begin(), order.end(), [&] (size_t l, size_t r) {
+    if(best[l].second != best[r].second) {
+      return best[l].second > best[r].second;
+    }
+    return gates[l]->_name < gates[r]->_name;
+  });
+
+  std::vector<std::pair<Gate*, const Cell*>> moves;
+  std::unordered_set<const Net*> nets;
+
+  for(auto i : order) {
+
+    const auto& pins = gates[i]->_pins;
+
+    if(std::any_of(pins.begin(), pins.end(), [&] (auto pin) {
+      return pin->_net && nets.find(pin->_net) != nets.end();
+    })) {
+      continue;
+    }
+
+    for(auto pin : pins) {
+      if(pin->_net) {
+        nets.insert(pin->_net);
+      }
+    }
+
+    moves.emplace_back(gates[i], best[i].first);
+  }
+
+  return moves;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,19 @@
+#ifndef OT_TIMER_SIZER_HPP_
+#define OT_TIMER_SIZER_HPP_
+
+#include <ot/headerdef.hpp>
+
+namespace ot {
+
+// Struct: SizerResult
+// The outcome of Timer::size_gates.
+struct SizerResult {
+  size_t num_iterations {0};
+  size_t num_moves {0};
+  std::optional<float> tns_before;   // late total negative slack before sizing
+  std::optional<float> tns_after;    // late total negative slack after sizing
+};
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -3,28 +3,85 @@
 namespace ot {
 
 // Function: read_spef
-Timer& Timer::read_spef(std::filesystem::path path) {
+Timer& Timer::read_spef(std::filesystem::path path, bool stream) {
+
+  std::scoped_lock lock(_mutex);
+
+  // A binary spef is mapped as is and decoded in the spef update task
+  if(BinarySpef::is_binary(path)) {
+    
+    auto binary = std::make_shared<BinarySpef>();
+
+    auto parser = _taskflow.emplace([path=std::move(path), binary] () {
+      OT_LOGI("mapping binary spef ", path);
+      if(!binary->open(path)) {
+        OT_LOGE("failed to open binary spef ", path);
+      }
+    });
+
+    auto reader = _taskflow.emplace([this, binary] () {
+      if(binary->is_open()) {
+        _read_spef(*binary);
+      }
+    });
+
+    parser.precede(reader);
+    
+    _add_to_lineage(reader);
+
+    return *this;
+  }
+
+  // Streaming mode parses and attaches nets in a single lineage task
+  if(stream) {
+    auto task = _taskflow.emplace([this, path=std::move(path)] (tf::Subflow& sf) {
+      _stream_spef(path, sf);
+    });
+    _add_to_lineage(task);
+    return *this;
+  }
 
   // Create a spefnet shared pointer
   auto spef = std::make_shared<spef::Spef>(); 
-  
-  std::scoped_lock lock(_mutex);
 
   // Reader task
   auto parser = _taskflow.emplace([path=std::move(path), spef] () {
     OT_LOGI("loading spef ", path);
-    if(spef->read(path); spef->error) {
+    // stream a compressed file in chunks of whole nets (the header goes with the first one)
+    if(compression(path) != Compression::NONE) {
+      auto cut = [] (std::string_view buf) {
+        auto pos = buf.rfind("\n*D_NET");
+        return (pos == std::string_view::npos || pos == 0) ? 0 : pos + 1;
+      };
+      auto consume = [&] (std::string& chunk) {
+        if(!spef->error) {
+          spef->read(chunk.data(), chunk.size());
+        }
+      };
+      if(!read_chunks(path, cut, consume)) {
+        OT_LOGE("failed to read spef ", path);
+      }
+    }
+    // map the file copy-on-write as the parser blanks out comments in place
+    else if(MappedFile file(path, true); !file.is_open()) {
+      OT_LOGE("failed to open spef ", path);
+    }
+    else {
+      spef->read(file.data(), file.size());
+    }
+    
+    if(spef->error) {
       OT_LOGE("Parser-SPEF error:\n", *spef->error);
     }
-    spef->expand_name();
+    spef->localize_name();
   });
   
   // Spef update task (this has to be after parser)
   auto reader = _taskflow.emplace([this, spef] () {
     if(!(spef->error)) {
       _rebase_unit(*spef);
-      _read_spef(*spef);
-      OT_LOGI("added ", spef->nets.size(), " spef nets");
+      auto num_updates = _read_spef(*spef);
+      OT_LOGI("added ", spef->nets.size(), " spef nets (", num_updates, " updated)");
     }
   });
   
@@ -36,18 +93,157 @@ Timer& Timer::read_spef(std::filesystem::path path) {
   return *this;
 }
 
+// Procedure: _stream_spef
+// Stream nets through a pipeline over a bounded window of chunks: chunks of whole nets are read
+// serially, parsed, expanded and rebased in parallel, and attached serially in file order.
+void Timer::_stream_spef(const std::filesystem::path& path, tf::Subflow& sf) {
+
+  OT_LOGI("streaming spef ", path);
+
+  // cut before the last *D_NET
+  ChunkReader reader(path, [] (std::string_view buf) {
+    auto pos = buf.rfind("\n*D_NET");
+    return (pos == std::string_view::npos || pos == 0) ? 0 : pos + 1;
+  }, 1 << 22);
+
+  if(!reader.good()) {
+    OT_LOGE("failed to open spef ", path);
+    return;
+  }
+
+  // the first chunk carries the header (units, name map and ports)
+  spef::Spef header;
+  
+  if(std::string text; reader.next(text)) {
+    if(header.read(text.data(), text.size()); header.error) {
+      OT_LOGE("Parser-SPEF error:\n", *header.error);
+      return;
+    }
+  }
+
+  // rebase the header nets and derive the scale of the remaining ones
+  _rebase_unit(header);
+
+  auto scale = [] (const auto& from, const auto& to) {
+    auto s = (from && to) ? (*from / *to).value() : 1.0f;
+    return std::fabs(s - 1.0f) >= 1e-2f ? s : 1.0f;
+  };
+
+  const float cs = scale(make_capacitance_unit(to_lower(header.capacitance_unit)), _capacitance_unit);
+  const float rs = scale(make_resistance_unit(to_lower(header.resistance_unit)), _resistance_unit);
+
+  for(auto& net : header.nets) {
+    header.localize_name(net);
+  }
+
+  size_t num_nets = header.nets.size();
+  size_t num_updates = _read_spef(header);
+  
+  // pipeline of the remaining nets
+  constexpr size_t num_lines = 4;
+
+  std::array<std::string, num_lines> texts;
+  std::array<spef::Spef, num_lines> parts;
+  std::atomic<bool> failed {false};
+
+  tf::Pipeline pipeline(num_lines,
+
+    // stage 1: read the next chunk of nets
+    tf::Pipe{tf::PipeType::SERIAL, [&] (tf::Pipeflow& pf) {
+      if(failed || !reader.next(texts[pf.line()])) {
+        pf.stop();
+      }
+    }},
+
+    // stage 2: parse the chunk, expand the names and rebase the units
+    tf::Pipe{tf::PipeType::PARALLEL, [&] (tf::Pipeflow& pf) {
+      auto& part = parts[pf.line()];
+      part.read(texts[pf.line()].data(), texts[pf.line()].size(), 1);
+      texts[pf.line()].clear();
+      for(auto& net : part.nets) {
+        header.localize_name(net);
+      }
+      if(cs != 1.0f) {
+        part.scale_capacitance(cs);
+      }
+      if(rs != 1.0f) {
+        part.scale_resistance(rs);
+      }
+    }},
+
+    // stage 3: attach the nets to the timer
+    tf::Pipe{tf::PipeType::SERIAL, [&] (tf::Pipeflow& pf) {
+      auto& part = parts[pf.line()];
+      if(part.error) {
+        if(!failed.exchange(true)) {
+          OT_LOGE("Parser-SPEF error:\n", *part.error);
+        }
+      }
+      else {
+        num_nets += part.nets.size();
+        num_updates += _read_spef(part);
+      }
+      part.nets.clear();
+      part.error.reset();
+    }}
+  );
+
+  sf.composed_of(pipeline);
+  sf.join();
+
+  OT_LOGI("added ", num_nets, " spef nets (", num_updates, " updated)");
+}
+
 // Procedure: _read_spef
-void Timer::_read_spef(spef::Spef& spef) {
+// Decode the nets of a binary spef without any text parsing. When the file covers more nets
+// than the design, only the nets of the design are looked up and decoded (partial load).
+void Timer::_read_spef(const BinarySpef& binary) {
+
+  spef::Spef spef;
+
+  binary.read_header(spef);
+
+  if(_nets.size() < binary.num_nets()) {
+    spef.nets.reserve(_nets.size());
+    for(const auto& kvp : _nets) {
+      if(auto net = binary.net(kvp.first); net) {
+        spef.nets.push_back(std::move(*net));
+      }
+    }
+  }
+  else {
+    binary.read(spef);
+  }
+
+  _rebase_unit(spef);
+  
+  auto num_updates = _read_spef(spef);
+
+  OT_LOGI(
+    "added ", spef.nets.size(), " of ", binary.num_nets(), " binary spef nets (", 
+    num_updates, " updated)"
+  );
+}
+
+// Function: _read_spef
+// Attach spef nets to the timer and return the number of nets whose parasitics changed.
+// Nets identical to the ones already attached do not invalidate any timing.
+size_t Timer::_read_spef(spef::Spef& spef) {
+
+  size_t num_updates {0};
+
   for(auto& spef_net : spef.nets) {
     if(auto itr = _nets.find(spef_net.name); itr == _nets.end()) {
       OT_LOGW("spef net ", spef_net.name, " not found");
       continue;
     }
-    else {
-      itr->second._attach(std::move(spef_net));
+    else if(itr->second._attach(std::move(spef_net))) {
       _insert_frontier(*itr->second._root);
+      ++num_updates;
     }
   }
+
+  return num_updates;
 }
 
 };  // end of namespace ot. -----------------------------------------------------------------------
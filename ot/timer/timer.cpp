@@ -14,10 +14,46 @@ Timer& Timer::set_num_threads(unsigned n) {
   return *this;
 }
 
+// Function: set_lut_tolerance
+// Set the tolerance of the input slew and the output load within which a cell arc reuses its
+// last lookup-table evaluation instead of evaluating the tables again. The default tolerance
+// is zero, i.e., only identical inputs reuse the evaluation and the timing is exact.
+Timer& Timer::set_lut_tolerance(float tolerance) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto op = _taskflow.emplace([this, tolerance] () {
+    _lut_tolerance = std::max(tolerance, 0.0f);
+  });
+
+  _add_to_lineage(op, true);
+
+  return *this;
+}
+
+// Function: report_lut_stats
+// Report the numbers of lookup-table evaluations of cell arcs reused and performed by the
+// timing updates so far.
+LutStats Timer::report_lut_stats() {
+
+  std::scoped_lock lock(_mutex);
+
+  _update_timing();
+
+  return LutStats {_num_lut_hits.load(), _num_lut_misses.load()};
+}
+
 // Procedure: _add_to_lineage
-void Timer::_add_to_lineage(tf::Task task) {
+// Append a builder task to the lineage. A builder that logs its undo within a transaction is
+// reversible; any other builder within a transaction makes the transaction irreversible.
+void Timer::_add_to_lineage(tf::Task task, bool reversible) {
+
   _lineage | [&] (auto& p) { p.precede(task); };
   _lineage = task;
+
+  if(_transaction && !reversible) {
+    _transaction->_reversible = false;
+  }
 }
 
 // Function: _max_pin_name_size
@@ -57,10 +93,11 @@ Timer& Timer::repower_gate(std::string gate, std::string cell) {
   std::scoped_lock lock(_mutex);
 
   auto task = _taskflow.emplace([this, gate=std::move(gate), cell=std::move(cell)] () {
+    _record_gate(gate);
     _repower_gate(gate, cell);
   });
   
-  _add_to_lineage(task);
+  _add_to_lineage(task, true);
 
   return *this;
 }
@@ -84,6 +121,15 @@ void Timer::_repower_gate(const std::string& gname, const std::string& cname) {
 
     auto& gate = gitr->second;
 
+    // Fast path: the new cell is footprint-compatible, and the gate is remapped in place
+    if(auto tvs = _isomorphic_timing_views(gate, cell); tvs) {
+      _remap_gate(gate, cell, *tvs);
+      for(auto pin : gate._pins) {
+        _insert_frontier(_remap_frontier(*pin));
+      }
+      return;
+    }
+
     // Remap the cellpin
     for(auto pin : gate._pins) {
       FOR_EACH_EL(el) {
@@ -123,10 +169,11 @@ Timer& Timer::insert_gate(std::string gate, std::string cell) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, gate=std::move(gate), cell=std::move(cell)] () {
+    _record_gate(gate);
     _insert_gate(gate, cell);
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -147,8 +194,21 @@ void Timer::_insert_gate(const std::string& gname, const std::string& cname) {
     OT_LOGE("cell ", cname, " not found in celllib");
     return;
   }
+
+  _insert_gate(gname, cell);
+}
+
+// Function: _insert_gate
+// Insert a gate of a resolved cell together with its pins and arcs.
+void Timer::_insert_gate(const std::string& gname, const CellView& cell) {
+
+  if(_gates.find(gname) != _gates.end()) {
+    OT_LOGW("gate ", gname, " already existed");
+    return;
+  }
   
   auto& gate = _gates.try_emplace(gname, gname, cell).first->second;
+  _gate_names.invalidate();
   
   // Insert pins
   for(const auto& [cpname, ecpin] : cell[MIN]->cellpins) {
@@ -181,12 +241,13 @@ Timer& Timer::remove_gate(std::string gate) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, gate=std::move(gate)] () {
+    _record_gate(gate);
     if(auto gitr = _gates.find(gate); gitr != _gates.end()) {
       _remove_gate(gitr->second);
     }
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -215,7 +276,100 @@ void Timer::_remove_gate(Gate& gate) {
   }
 
   // remove the gate
+  _replace_power(gate._power, Power{});
   _gates.erase(gate._name);
+  _gate_names.invalidate();
+}
+
+// Function: _isomorphic_timing_views
+// Map each arc of a gate to the isomorphic timing (same related pin, timing sense and 
+// timing type) of a new cell. The mapping exists only if the new cell is footprint-compatible
+// with the gate, i.e., the same cellpins and a one-to-one mapping of the timings.
+std::optional<std::vector<TimingView>> Timer::_isomorphic_timing_views(
+  const Gate& gate, const CellView& cell
+) const {
+
+  size_t num_timings {0};
+
+  FOR_EACH_EL(el) {
+
+    if(cell[el]->cellpins.size() != gate._cell[el]->cellpins.size()) {
+      return std::nullopt;
+    }
+
+    for(auto pin : gate._pins) {
+      if(!cell[el]->cellpin(pin->cellpin(el)->name)) {
+        return std::nullopt;
+      }
+    }
+
+    for(const auto& [cpname, cp] : cell[el]->cellpins) {
+      for(const auto& tm : cp.timings) {
+        num_timings += !_is_redundant_timing(tm, el);
+      }
+    }
+  }
+
+  if(num_timings != gate._arcs.size()) {
+    return std::nullopt;
+  }
+
+  std::vector<TimingView> tvs;
+  std::unordered_set<const Timing*> mapped;
+
+  tvs.reserve(gate._arcs.size());
+
+  for(auto arc : gate._arcs) {
+
+    auto ptv = arc->timing_view();
+    auto& ntv = tvs.emplace_back(TimingView{nullptr, nullptr});
+
+    FOR_EACH_EL_IF(el, ptv[el]) {
+
+      auto tcp = cell[el]->cellpin(arc->_to.cellpin(el)->name);
+      auto ntm = tcp->isomorphic_timing(*ptv[el]);
+
+      // two timings mapped to the same one (e.g., distinguished only by conditions)
+      if(ntm == nullptr || !mapped.insert(ntm).second) {
+        return std::nullopt;
+      }
+
+      ntv[el] = ntm;
+    }
+  }
+
+  return tvs;
+}
+
+// Procedure: _remap_gate
+// Remap a gate in place to a footprint-compatible cell, given the new timing of each arc
+// (see _isomorphic_timing_views). The arcs and tests are kept, and only the gate, its pins
+// and arcs are changed.
+void Timer::_remap_gate(Gate& gate, const CellView& cell, const std::vector<TimingView>& tvs) {
+
+  for(auto pin : gate._pins) {
+    FOR_EACH_EL(el) {
+      pin->_remap_cellpin(el, *cell[el]->cellpin(pin->cellpin(el)->name));
+    }
+  }
+
+  for(size_t i=0; i<gate._arcs.size(); ++i) {
+    FOR_EACH_EL_IF(el, tvs[i][el]) {
+      gate._arcs[i]->_remap_timing(el, *tvs[i][el]);
+    }
+  }
+
+  gate._cell = cell;
+}
+
+// Function: _remap_frontier
+// The pin to update after a pin of a gate is remapped in place: the delays change at an output
+// pin, and the capacitance of an input pin changes the load of its net (updated from the driver).
+Pin& Timer::_remap_frontier(Pin& pin) {
+  if(pin.is_output() || !pin._net || !pin._net->_root) {
+    return pin;
+  }
+  return *(pin._net->_root);
 }
 
 // Procedure: _remove_gate_arcs
@@ -274,6 +428,7 @@ Timer& Timer::connect_pin(std::string pin, std::string net) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, pin=std::move(pin), net=std::move(net)] () {
+    _record_pin(pin, net);
     auto p = _pins.find(pin);
     auto n = _nets.find(net);
     OT_LOGE_RIF(p==_pins.end() || n == _nets.end(),
@@ -282,7 +437,7 @@ Timer& Timer::connect_pin(std::string pin, std::string net) {
     _connect_pin(p->second, n->second);
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -319,12 +474,13 @@ Timer& Timer::disconnect_pin(std::string name) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, name=std::move(name)] () {
+    _record_pin(name);
     if(auto itr = _pins.find(name); itr != _pins.end()) {
       _disconnect_pin(itr->second);
     }
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -349,6 +505,8 @@ void Timer::_disconnect_pin(Pin& pin) {
         _remove_arc(*arc);
       }
     }
+    // the net no longer switches
+    _replace_power(net->_power, Power{});
   }
   // Case 2: the pin is not a root of the net.
   else {
@@ -374,16 +532,18 @@ Timer& Timer::insert_net(std::string name) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, name=std::move(name)] () {
+    _record_insert_net(name);
     _insert_net(name);
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
 
 // Function: _insert_net
 Net& Timer::_insert_net(const std::string& name) {
+  _net_names.invalidate();
   return _nets.try_emplace(name, name).first->second;
 }
 
@@ -394,12 +554,13 @@ Timer& Timer::remove_net(std::string name) {
   std::scoped_lock lock(_mutex);
 
   auto op = _taskflow.emplace([this, name=std::move(name)] () {
+    _record_remove_net(name);
     if(auto itr = _nets.find(name); itr != _nets.end()) {
       _remove_net(itr->second);
     }
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -414,7 +575,9 @@ void Timer::_remove_net(Net& net) {
     }
   }
 
+  _replace_power(net._power, Power{});
   _nets.erase(net._name);
+  _net_names.invalidate();
 }
 
 // Function: _insert_pin
@@ -427,6 +590,8 @@ Pin& Timer::_insert_pin(const std::string& name) {
   // inserted a new pon
   else {
     
+    _pin_names.invalidate();
+    
     // Generate the pin idx
     auto& pin = itr->second;
     
@@ -448,6 +613,7 @@ void Timer::_remove_pin(Pin& pin) {
   assert(pin.num_fanouts() == 0 && pin.num_fanins() == 0 && pin.net() == nullptr);
 
   _remove_frontier(pin);
+  _remove_deferred(pin);
 
   // remove the id mapping
   _idx2pin[pin._idx] = nullptr;
@@ -455,6 +621,7 @@ void Timer::_remove_pin(Pin& pin) {
 
   // remove the pin
   _pins.erase(pin._name);
+  _pin_names.invalidate();
 }
 
 // Function: cppr
@@ -531,12 +698,19 @@ Timer& Timer::create_clock(std::string c, float p) {
 Clock& Timer::_create_clock(const std::string& name, Pin& pin, float period) {
   auto& clock = _clocks.try_emplace(name, name, pin, period).first->second;
   _insert_frontier(pin);
+  // the default switching activity is relative to the clock
+  if(_power_analysis) {
+    _enable_full_timing_update();
+  }
   return clock;
 }
 
 // Procedure: _create_clock
 Clock& Timer::_create_clock(const std::string& name, float period) {
   auto& clock = _clocks.try_emplace(name, name, period).first->second;
+  if(_power_analysis) {
+    _enable_full_timing_update();
+  }
   return clock;
 }
 
@@ -567,6 +741,7 @@ void Timer::_insert_primary_input(const std::string& name) {
   // Insert the pin and and pi
   auto& pin = _insert_pin(name);
   auto& pi = _pis.try_emplace(name, pin).first->second;
+  _pi_names.invalidate();
   
   // Associate the connection.
   pin._handle = &pi;
@@ -608,6 +783,7 @@ void Timer::_insert_primary_output(const std::string& name) {
   // Insert the pin and and pi
   auto& pin = _insert_pin(name);
   auto& po = _pos.try_emplace(name, pin).first->second;
+  _po_names.invalidate();
   
   // Associate the connection.
   pin._handle = &po;
@@ -729,9 +905,14 @@ void Timer::_fprop_slew(Pin& pin) {
   }
   
   // Relax the slew from its fanin.
+  LutStats stats;
+
   for(auto arc : pin._fanin) {
-    arc->_fprop_slew();
+    arc->_fprop_slew(_lut_tolerance, stats);
   }
+
+  _num_lut_hits += stats.num_hits;
+  _num_lut_misses += stats.num_misses;
 }
 
 // Procedure: _fprop_delay
@@ -744,7 +925,7 @@ void Timer::_fprop_delay(Pin& pin) {
 
   // Compute the delay from its fanin.
   for(auto arc : pin._fanin) {
-    arc->_fprop_delay();
+    arc->_fprop_delay(_lut_tolerance);
   }
 }
 
@@ -834,7 +1015,11 @@ void Timer::_build_fprop_cands(Pin& from) {
   from._insert_state(Pin::FPROP_CAND | Pin::IN_FPROP_STACK);
 
   for(auto arc : from._fanout) {
-    if(auto& to = arc->_to; !to._has_state(Pin::FPROP_CAND)) {
+    // a bounded propagation stays within the marked pins
+    if(auto& to = arc->_to; _fprop_bounded && !to._has_state(Pin::FPROP_BOUND)) {
+      continue;
+    }
+    else if(!to._has_state(Pin::FPROP_CAND)) {
       _build_fprop_cands(to);
     }
     else if(to._has_state(Pin::IN_FPROP_STACK)) {
@@ -915,6 +1100,7 @@ void Timer::_build_prop_tasks() {
   // (2) propagate the slew 
   // (3) propagate the delay
   // (4) propagate the arrival time.
+  // (5) propagate the switching activity (power analysis)
   for(auto pin : _fprop_cands) {
     assert(!pin->_ftask);
     pin->_ftask = _taskflow.emplace([this, pin] () {
@@ -923,6 +1109,9 @@ void Timer::_build_prop_tasks() {
       _fprop_delay(*pin);
       _fprop_at(*pin);
       _fprop_test(*pin);
+      if(_power_analysis) {
+        _fprop_activity(*pin);
+      }
     });
   }
   
@@ -986,45 +1175,81 @@ void Timer::_clear_prop_tasks() {
 // Perform comprehensive timing update: 
 // (1) grpah-based timing (GBA)
 // (2) path-based timing (PBA)
-void Timer::update_timing() {
+// An exact update also propagates the regions deferred by approximate updates
+// (see set_approximate_update).
+void Timer::update_timing(bool exact) {
   std::scoped_lock lock(_mutex);
-  _update_timing();
+  _update_timing(exact);
 }
 
 // Function: _update_timing
-void Timer::_update_timing() {
+void Timer::_update_timing(bool exact) {
   
-  // Timing is update-to-date
-  if(!_lineage) {
+  // Timing is update-to-date (or the deferred regions stay approximate)
+  if(!_lineage && (_deferred.empty() || (!exact && _approx_depth))) {
     assert(_frontiers.size() == 0);
     return;
   }
 
   // materialize the lineage
-  _executor.run(_taskflow).wait();
-  _taskflow.clear();
-  _lineage.reset();
+  if(_lineage) {
+    _executor.run(_taskflow).wait();
+    _taskflow.clear();
+    _lineage.reset();
+  }
+
+  // Reconcile the regions deferred by approximate updates
+  if(exact || !_approx_depth) {
+    _reconcile_deferred();
+  }
   
   // Check if full update is required
   if(_has_state(FULL_TIMING)) {
     _insert_full_timing_frontiers();
+    _clear_deferred();
   }
 
-  // build propagation tasks
-  _build_prop_tasks();
+  auto bounded = !exact && _approx_depth && !_has_state(FULL_TIMING);
 
-  // debug the graph
-  //_taskflow.dump(std::cout);
+  // propagate in rounds of bounded depth, or once if the update is not approximate
+  do {
 
-  // Execute the task
-  _executor.run(_taskflow).wait();
-  _taskflow.clear();
-  
-  // Clear the propagation tasks.
-  _clear_prop_tasks();
+    if(bounded) {
+      _build_fprop_bound(*_approx_depth);
+    }
+
+    // build propagation tasks
+    _build_prop_tasks();
+
+    // save the timing values to restore on rollback
+    if(_transaction) {
+      _save_timing();
+    }
+
+    // debug the graph
+    //_taskflow.dump(std::cout);
+
+    // Execute the task
+    _executor.run(_taskflow).wait();
+    _taskflow.clear();
+    
+    // Update the power of the gates and nets propagated
+    if(_power_analysis) {
+      _update_power(_fprop_cands);
+    }
+
+    // Clear the propagation tasks.
+    _clear_prop_tasks();
+
+    // Clear frontiers
+    _clear_frontiers();
 
-  // Clear frontiers
-  _clear_frontiers();
+    // Defer (or propagate in the next round) the fanouts beyond the bound
+    if(bounded) {
+      _defer_fprop_bound();
+    }
+
+  } while(!_frontiers.empty());
 
   // clear the state
   _remove_state();
@@ -1081,6 +1306,28 @@ void Timer::_update_power() {
   _insert_state(POWER_UPDATED);
 }
 
+// Procedure: _update_ipower
+// Evaluate the internal power of all cell arcs at the current slews and loads in parallel.
+// The timing propagation does not evaluate the internal power, which is needed only by the
+// power analysis, and the evaluation is kept until the timing changes.
+void Timer::_update_ipower() {
+
+  if(_has_state(IPOWER_UPDATED)) {
+    return;
+  }
+
+  // a separate taskflow leaves the pending lineage untouched
+  tf::Taskflow taskflow;
+
+  taskflow.for_each(_arcs.begin(), _arcs.end(), [] (Arc& arc) {
+    arc._update_ipower();
+  });
+
+  _executor.run(taskflow).wait();
+
+  _insert_state(IPOWER_UPDATED);
+}
+
 // Procedure: _update_endpoints
 void Timer::_update_endpoints() {
 
@@ -1277,6 +1524,11 @@ void Timer::_insert_full_timing_frontiers() {
   for(auto& kvp : _nets) {
     kvp.second._rc_timing_updated = false;
   }
+
+  // clear the lookup-table memo (the libraries may have been replaced or rescaled)
+  for(auto& arc : _arcs) {
+    arc._memo.reset();
+  }
 }
 
 // Procedure: _insert_frontier
@@ -1412,6 +1664,7 @@ Timer& Timer::set_at(std::string name, Split m, Tran t, std::optional<float> v)
   std::scoped_lock lock(_mutex);
 
   auto task = _taskflow.emplace([this, name=std::move(name), m, t, v] () {
+    _record_port(name);
     if(auto itr = _pis.find(name); itr != _pis.end()) {
       _set_at(itr->second, m, t, v);
     }
@@ -1420,7 +1673,7 @@ Timer& Timer::set_at(std::string name, Split m, Tran t, std::optional<float> v)
     }
   });
 
-  _add_to_lineage(task);
+  _add_to_lineage(task, true);
 
   return *this;
 }
@@ -1437,6 +1690,7 @@ Timer& Timer::set_rat(std::string name, Split m, Tran t, std::optional<float> v)
   std::scoped_lock lock(_mutex);
   
   auto op = _taskflow.emplace([this, name=std::move(name), m, t, v] () {
+    _record_port(name);
     if(auto itr = _pos.find(name); itr != _pos.end()) {
       _set_rat(itr->second, m, t, v);
     }
@@ -1445,7 +1699,7 @@ Timer& Timer::set_rat(std::string name, Split m, Tran t, std::optional<float> v)
     }
   });
 
-  _add_to_lineage(op);
+  _add_to_lineage(op, true);
 
   return *this;
 }
@@ -1462,6 +1716,7 @@ Timer& Timer::set_slew(std::string name, Split m, Tran t, std::optional<float> v
   std::scoped_lock lock(_mutex);
   
   auto task = _taskflow.emplace([this, name=std::move(name), m, t, v] () {
+    _record_port(name);
     if(auto itr = _pis.find(name); itr != _pis.end()) {
       _set_slew(itr->second, m, t, v);
     }
@@ -1470,7 +1725,7 @@ Timer& Timer::set_slew(std::string name, Split m, Tran t, std::optional<float> v
     }
   });
 
-  _add_to_lineage(task);
+  _add_to_lineage(task, true);
 
   return *this;
 }
@@ -1487,6 +1742,7 @@ Timer& Timer::set_load(std::string name, Split m, Tran t, std::optional<float> v
   std::scoped_lock lock(_mutex);
   
   auto task = _taskflow.emplace([this, name=std::move(name), m, t, v] () {
+    _record_port(name);
     if(auto itr = _pos.find(name); itr != _pos.end()) {
       _set_load(itr->second, m, t, v);
     }
@@ -1495,7 +1751,7 @@ Timer& Timer::set_load(std::string name, Split m, Tran t, std::optional<float> v
     }
   });
 
-  _add_to_lineage(task);
+  _add_to_lineage(task, true);
 
   return *this;
 }
@@ -1518,6 +1774,59 @@ void Timer::_set_load(PrimaryOutput& po, Split m, Tran t, std::optional<float> v
 }
 
 
+// Function: find_pins
+// Find the names of the pins matching a glob pattern (* and ?) or a regular expression.
+std::vector<std::string> Timer::find_pins(const std::string& pattern, bool regex) {
+  std::scoped_lock lock(_mutex);
+  _update_timing();
+  std::vector<std::string> names;
+  for(auto pin : _find(_pins, _pin_names, pattern, regex)) {
+    names.push_back(pin->_name);
+  }
+  return names;
+}
+
+// Function: find_ports
+// Find the names of the primary inputs and outputs matching a glob pattern or a regular 
+// expression.
+std::vector<std::string> Timer::find_ports(const std::string& pattern, bool regex) {
+  std::scoped_lock lock(_mutex);
+  _update_timing();
+  std::vector<std::string> pis, pos, names;
+  for(auto pi : _find(_pis, _pi_names, pattern, regex)) {
+    pis.push_back(pi->_pin._name);
+  }
+  for(auto po : _find(_pos, _po_names, pattern, regex)) {
+    pos.push_back(po->_pin._name);
+  }
+  std::merge(pis.begin(), pis.end(), pos.begin(), pos.end(), std::back_inserter(names));
+  return names;
+}
+
+// Function: find_gates
+// Find the names of the gates matching a glob pattern or a regular expression.
+std::vector<std::string> Timer::find_gates(const std::string& pattern, bool regex) {
+  std::scoped_lock lock(_mutex);
+  _update_timing();
+  std::vector<std::string> names;
+  for(auto gate : _find(_gates, _gate_names, pattern, regex)) {
+    names.push_back(gate->_name);
+  }
+  return names;
+}
+
+// Function: find_nets
+// Find the names of the nets matching a glob pattern or a regular expression.
+std::vector<std::string> Timer::find_nets(const std::string& pattern, bool regex) {
+  std::scoped_lock lock(_mutex);
+  _update_timing();
+  std::vector<std::string> names;
+  for(auto net : _find(_nets, _net_names, pattern, regex)) {
+    names.push_back(net->_name);
+  }
+  return names;
+}
+
 };  // end of namespace ot. -----------------------------------------------------------------------
 
 
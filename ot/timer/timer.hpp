@@ -13,6 +13,12 @@
 #include <ot/timer/pfxt.hpp>
 #include <ot/timer/cppr.hpp>
 #include <ot/timer/scc.hpp>
+#include <ot/timer/checkpoint.hpp>
+#include <ot/timer/transaction.hpp>
+#include <ot/timer/eco.hpp>
+#include <ot/timer/what_if.hpp>
+#include <ot/timer/sizer.hpp>
+#include <ot/timer/approximate.hpp>
 #include <ot/static/logger.hpp>
 #include <ot/spef/spef.hpp>
 #include <ot/verilog/verilog.hpp>
@@ -30,6 +36,7 @@ class Timer {
   constexpr static int EPTS_UPDATED  = 0x02;
   constexpr static int AREA_UPDATED  = 0x04;
   constexpr static int POWER_UPDATED = 0x08;
+  constexpr static int IPOWER_UPDATED = 0x10;
 
   public:
     
@@ -37,9 +44,12 @@ class Timer {
     Timer& set_num_threads(unsigned);
     Timer& read_celllib(std::filesystem::path, std::optional<Split> = {});
     Timer& read_verilog(std::filesystem::path);
-    Timer& read_spef(std::filesystem::path);
+    Timer& insert_netlist(vlog::Netlist);
+    Timer& insert_netlist(vlog::Module);
+    Timer& read_spef(std::filesystem::path, bool = false);
     Timer& read_sdc(std::filesystem::path);
     Timer& read_timing(std::filesystem::path);
+    Timer& load_checkpoint(std::filesystem::path);
     Timer& insert_net(std::string);
     Timer& insert_gate(std::string, std::string);
     Timer& repower_gate(std::string, std::string);
@@ -47,6 +57,17 @@ class Timer {
     Timer& remove_gate(std::string);
     Timer& disconnect_pin(std::string);
     Timer& connect_pin(std::string, std::string);
+    Timer& insert_buffer(
+      std::string, 
+      std::vector<std::string>, 
+      std::string, 
+      std::string, 
+      std::string, 
+      std::optional<spef::Net> = {}, 
+      std::optional<spef::Net> = {}
+    );
+    Timer& remove_buffer(std::string, std::optional<spef::Net> = {});
+    Timer& apply_ecos(std::vector<Eco>);
     Timer& insert_primary_input(std::string);
     Timer& insert_primary_output(std::string);
     Timer& set_at(std::string, Split, Tran, std::optional<float>);
@@ -56,6 +77,11 @@ class Timer {
     Timer& create_clock(std::string, float);
     Timer& create_clock(std::string, std::string, float);
     Timer& cppr(bool);
+    Timer& power_analysis(bool);
+    Timer& set_switching_activity(std::string, std::optional<Activity>);
+    Timer& set_default_switching_activity(std::optional<Activity>);
+    Timer& set_approximate_update(std::optional<size_t>, std::optional<float> = {});
+    Timer& set_lut_tolerance(float);
     Timer& set_time_unit(second_t);
     Timer& set_capacitance_unit(farad_t);
     Timer& set_resistance_unit(ohm_t);
@@ -64,7 +90,15 @@ class Timer {
     Timer& set_current_unit(ampere_t);
 
     // Action.
-    void update_timing();
+    void update_timing(bool = false);
+    void save_checkpoint(const std::filesystem::path&);
+
+    std::unique_ptr<Timer> fork();
+
+    // Transaction
+    void begin_transaction();
+    void commit();
+    void rollback();
 
     std::optional<float> report_at(const std::string&, Split, Tran);
     std::optional<float> report_rat(const std::string&, Split, Tran);
@@ -73,9 +107,28 @@ class Timer {
     std::optional<float> report_load(const std::string&, Split, Tran);
     std::optional<float> report_area();
     std::optional<float> report_leakage_power();
+    std::optional<Power> report_power();
+    std::optional<Power> report_gate_power(const std::string&);
+    std::optional<Power> report_net_power(const std::string&);
+    std::optional<Activity> report_switching_activity(const std::string&);
     std::optional<float> report_tns(std::optional<Split> = {}, std::optional<Tran> = {});
     std::optional<float> report_wns(std::optional<Split> = {}, std::optional<Tran> = {});
     std::optional<size_t> report_fep(std::optional<Split> = {}, std::optional<Tran> = {});
+
+    const Footprint* report_equivalent_cells(const std::string&, Split = MIN);
+
+    std::optional<RepowerEstimate> what_if_repower(const std::string&, const std::string&);
+
+    SizerResult size_gates(size_t = 10);
+
+    LutStats report_lut_stats();
+
+    std::vector<std::string> report_approximate_pins();
+
+    std::vector<std::string> find_pins(const std::string&, bool = false);
+    std::vector<std::string> find_ports(const std::string&, bool = false);
+    std::vector<std::string> find_gates(const std::string&, bool = false);
+    std::vector<std::string> find_nets(const std::string&, bool = false);
     
     std::vector<Path> report_timing(size_t);
     std::vector<Path> report_timing(size_t, Split);
@@ -85,7 +138,7 @@ class Timer {
 
     // Accessor
     void dump_graph(std::ostream&) const;
-    void dump_power(std::ostream&) const;
+    void dump_power(std::ostream&);
     void dump_taskflow(std::ostream&) const;
     void dump_cell(std::ostream&, const std::string&, Split) const;
     void dump_celllib(std::ostream&, Split) const;
@@ -135,9 +188,21 @@ class Timer {
     int _state {0};
     
     bool _scc_analysis {false};
+    bool _fprop_bounded {false};
+
+    std::optional<size_t> _approx_depth;
+    std::optional<float> _approx_threshold;
+
+    float _lut_tolerance {0.0f};
+
+    std::atomic<size_t> _num_lut_hits {0};
+    std::atomic<size_t> _num_lut_misses {0};
 
     std::optional<tf::Task> _lineage;
     std::optional<CpprAnalysis> _cppr_analysis;
+    std::optional<PowerAnalysis> _power_analysis;
+    std::optional<Activity> _default_activity;
+    std::optional<Transaction> _transaction;
     std::optional<second_t> _time_unit;
     std::optional<watt_t> _power_unit;
     std::optional<ohm_t> _resistance_unit;
@@ -145,7 +210,8 @@ class Timer {
     std::optional<ampere_t> _current_unit;
     std::optional<volt_t> _voltage_unit;
 
-    TimingData<std::optional<Celllib>, MAX_SPLIT> _celllib;
+    TimingData<std::shared_ptr<Celllib>, MAX_SPLIT> _celllib;
+    TimingData<std::vector<std::filesystem::path>, MAX_SPLIT> _celllib_paths;
 
     std::unordered_map<std::string, PrimaryInput> _pis;
     std::unordered_map<std::string, PrimaryOutput> _pos; 
@@ -153,10 +219,17 @@ class Timer {
     std::unordered_map<std::string, Net> _nets;
     std::unordered_map<std::string, Gate> _gates;
     std::unordered_map<std::string, Clock> _clocks;
+
+    NameIndex _pi_names;
+    NameIndex _po_names;
+    NameIndex _pin_names;
+    NameIndex _net_names;
+    NameIndex _gate_names;
  
     std::list<Test> _tests;
     std::list<Arc> _arcs;
     std::list<Pin*> _frontiers;
+    std::list<Pin*> _deferred;
     std::list<SCC> _sccs;
 
     TimingData<std::vector<Endpoint>, MAX_SPLIT, MAX_TRAN> _endpoints;
@@ -174,6 +247,7 @@ class Timer {
     IndexGenerator<size_t> _arc_idx_gen {0u};
     
     std::vector<Pin*> _scc_cands;
+    std::vector<FpropBoundary> _fprop_boundary;
     std::vector<Pin*> _idx2pin;
     std::vector<Arc*> _idx2arc;
 
@@ -186,6 +260,10 @@ class Timer {
     std::vector<Path> _report_timing(std::vector<Endpoint*>&&, size_t);
     
     bool _is_redundant_timing(const Timing&, Split) const;
+    std::optional<std::pair<std::string, std::string>> _buffer_cellpins(const std::string&) const;
+    std::optional<std::vector<TimingView>> _isomorphic_timing_views(const Gate&, const CellView&) const;
+    std::optional<RepowerEstimate> _what_if_repower(const std::string&, const std::string&) const;
+    std::vector<std::pair<Gate*, const Cell*>> _sizing_moves();
 
     void _to_time_unit(const second_t&);
     void _to_capacitance_unit(const farad_t&);
@@ -193,13 +271,17 @@ class Timer {
     void _to_power_unit(const watt_t&);
     void _to_current_unit(const ampere_t&);
     void _to_voltage_unit(const volt_t&);
-    void _add_to_lineage(tf::Task);
+    void _add_to_lineage(tf::Task, bool = false);
     void _rebase_unit(Celllib&);
     void _rebase_unit(spef::Spef&);
-    void _update_timing();
+    void _update_timing(bool = false);
     void _update_endpoints();
     void _update_area();
     void _update_power();
+    void _update_ipower();
+    void _update_power(const std::deque<Pin*>&);
+    void _replace_power(Power&, const Power&);
+    void _fprop_activity(Pin&);
     void _fprop_rc_timing(Pin&);
     void _fprop_slew(Pin&);
     void _fprop_delay(Pin&);
@@ -211,9 +293,21 @@ class Timer {
     void _build_bprop_cands(Pin&);
     void _build_prop_tasks();
     void _clear_prop_tasks();
-    void _read_spef(spef::Spef&);;
-    void _verilog(vlog::Module&);
+    size_t _read_spef(spef::Spef&);
+    void _read_spef(const BinarySpef&);
+    void _stream_spef(const std::filesystem::path&, tf::Subflow&);
+    void _verilog(vlog::Netlist&, tf::Subflow&);
     void _timing(tau15::Timing&);
+    void _save_checkpoint(std::ostream&) const;
+    void _save_timing();
+    void _save_timing(Net&);
+    void _save_timing(Pin&);
+    void _restore_timing(Pin&, const Transaction::PinTiming&);
+    void _record_gate(const std::string&);
+    void _record_insert_net(const std::string&);
+    void _record_remove_net(const std::string&);
+    void _record_pin(const std::string&, const std::string& = "");
+    void _record_port(const std::string&);
     void _read_sdc(sdc::SDC&);
     void _read_sdc(sdc::SetInputDelay&);
     void _read_sdc(sdc::SetInputTransition&);
@@ -226,14 +320,34 @@ class Timer {
     void _remove_frontier(Pin&);
     void _remove_scc(SCC&);
     void _clear_frontiers();
+    void _build_fprop_bound(size_t);
+    void _defer_fprop_bound();
+    void _insert_deferred(Pin&);
+    void _remove_deferred(Pin&);
+    void _clear_deferred();
+    void _reconcile_deferred();
     void _insert_primary_output(const std::string&);
     void _insert_primary_input(const std::string&);
     void _insert_gate(const std::string&, const std::string&);
+    void _insert_gate(const std::string&, const CellView&);
     void _insert_gate_arcs(Gate&);
     void _remove_gate_arcs(Gate&);
+    void _remap_gate(Gate&, const CellView&, const std::vector<TimingView>&);
     void _repower_gate(const std::string&, const std::string&);
     void _remove_gate(Gate&);
     void _remove_net(Net&);
+    void _insert_buffer(
+      const std::string&, 
+      const std::vector<std::string>&,
+      const std::string&,
+      const std::string&,
+      const std::string&,
+      std::optional<spef::Net>,
+      std::optional<spef::Net>
+    );
+    void _remove_buffer(const std::string&, std::optional<spef::Net>);
+    void _apply_ecos(const std::vector<Eco>&, tf::Subflow&);
+    void _apply_eco(const Eco&);
     void _remove_pin(Pin&);
     void _remove_arc(Arc&);
     void _remove_test(Test&);
@@ -242,6 +356,8 @@ class Timer {
     void _set_rat(PrimaryOutput&, Split, Tran, std::optional<float>);
     void _set_load(PrimaryOutput&, Split, Tran, std::optional<float>);
     void _cppr(bool);
+    void _power(bool);
+    void _set_switching_activity(PrimaryInput&, std::optional<Activity>);
     void _topologize(SfxtCache&, size_t) const;
     void _spfa(SfxtCache&) const;
     void _spdp(SfxtCache&) const;
@@ -272,6 +388,9 @@ class Timer {
 
     template <typename... T, std::enable_if_t<(sizeof...(T)>1), void>* = nullptr >
     void _insert_frontier(T&&...);
+
+    template <typename T>
+    std::vector<T*> _find(std::unordered_map<std::string, T>&, NameIndex&, std::string_view, bool);
     
     SfxtCache _sfxt_cache(const Endpoint&) const;
     SfxtCache _sfxt_cache(const PrimaryOutput&, Split, Tran) const;
@@ -280,6 +399,7 @@ class Timer {
     PfxtCache _pfxt_cache(const SfxtCache&) const;
 
     Net& _insert_net(const std::string&);
+    Pin& _remap_frontier(Pin&);
     Pin& _insert_pin(const std::string&);
     Arc& _insert_arc(Pin&, Pin&, Net&);
     Arc& _insert_arc(Pin&, Pin&, Test&);
@@ -289,6 +409,8 @@ class Timer {
     Clock& _create_clock(const std::string&, Pin&, float);
     Clock& _create_clock(const std::string&, float);
 
+    bool _load_checkpoint(std::string_view, tf::Subflow&);
+
     std::optional<float> _report_at(const std::string&, Split, Tran);
     std::optional<float> _report_rat(const std::string&, Split, Tran);
     std::optional<float> _report_slew(const std::string&, Split, Tran);
@@ -298,6 +420,15 @@ class Timer {
     std::optional<float> _cppr_credit(const CpprCache&, Pin&, Split, Tran) const;
     std::optional<float> _cppr_offset(const CpprCache&, Pin&, Split, Tran) const;
     std::optional<float> _sfxt_offset(const SfxtCache&, size_t) const;
+    std::optional<Activity> _output_activity(const Pin&) const;
+
+    Activity _input_activity(const PrimaryInput&) const;
+    Activity _default_switching_activity() const;
+
+    Power _gate_power(const Gate&, float) const;
+    Power _net_power(const Net&, float) const;
+
+    float _power_scale() const;
     
     size_t _max_pin_name_size() const;
     size_t _max_net_name_size() const;
@@ -317,6 +448,46 @@ template <typename... T, std::enable_if_t<(sizeof...(T)>1), void>*>
 void Timer::_insert_frontier(T&&... pins) {
   (_insert_frontier(pins), ...);
 }
+
+// Function: _find
+// Find the objects whose names match a glob pattern or a regular expression. A plain name
+// is looked up directly; otherwise the name index is (re)built on demand and resolves the
+// pattern over a narrow range of candidate names.
+template <typename T>
+std::vector<T*> Timer::_find(
+  std::unordered_map<std::string, T>& map, NameIndex& index, std::string_view pattern, bool regex
+) {
+
+  std::vector<T*> objects;
+
+  if(!regex && !is_pattern(pattern)) {
+    if(auto itr = map.find(std::string(pattern)); itr != map.end()) {
+      objects.push_back(&(itr->second));
+    }
+    return objects;
+  }
+
+  if(!index.is_valid()) {
+    index.build(map);
+  }
+
+  std::vector<std::string_view> names;
+
+  try {
+    names = index.match(pattern, regex);
+  }
+  catch(const std::regex_error& e) {
+    OT_LOGE("invalid regular expression ", std::quoted(pattern), " (", e.what(), ')');
+  }
+
+  objects.reserve(names.size());
+
+  for(auto name : names) {
+    objects.push_back(&(map.find(std::string(name))->second));
+  }
+
+  return objects;
+}
     
 // Function: num_primary_inputs
 inline auto Timer::num_primary_inputs() const {
@@ -0,0 +1,443 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Procedure: begin_transaction
+// Begin a transaction at the up-to-date timing. The reversible operations issued until the
+// next commit or rollback (see Timer::_add_to_lineage) are logged when they are applied.
+void Timer::begin_transaction() {
+
+  std::scoped_lock lock(_mutex);
+
+  if(_transaction) {
+    OT_LOGW("transaction already begun (nested transaction is not supported)");
+    return;
+  }
+
+  _update_timing();
+
+  _transaction.emplace();
+}
+
+// Procedure: commit
+// Keep the operations of the transaction.
+void Timer::commit() {
+
+  std::scoped_lock lock(_mutex);
+
+  if(!_transaction) {
+    OT_LOGW("no transaction to commit");
+    return;
+  }
+
+  _transaction.reset();
+}
+
+// Procedure: rollback
+// Undo the operations of the transaction and restore the timing values before the transaction.
+// Operations not yet applied are discarded, the applied ones are undone in reverse order, and
+// the saved values are written back to the pins, arcs and tests the transaction touched.
+void Timer::rollback() {
+
+  std::scoped_lock lock(_mutex);
+
+  if(!_transaction) {
+    OT_LOGW("no transaction to roll back");
+    return;
+  }
+
+  if(!_transaction->_reversible) {
+    OT_LOGE("transaction has an irreversible operation (committed instead of rolled back)");
+    _transaction.reset();
+    return;
+  }
+
+  // discard the operations not yet applied
+  _taskflow.clear();
+  _lineage.reset();
+
+  auto transaction = std::move(*_transaction);
+
+  _transaction.reset();
+
+  // undo the applied operations
+  for(auto itr = transaction._undos.rbegin(); itr != transaction._undos.rend(); ++itr) {
+    (*itr)();
+  }
+
+  // restore the timing values (pins created within the transaction were removed by the undo)
+  for(auto& [name, timing] : transaction._timing) {
+    if(auto itr = _pins.find(name); itr != _pins.end()) {
+      _restore_timing(itr->second, timing);
+    }
+  }
+
+  // restore the power of the gates and nets (and the total power by the changes)
+  for(const auto& [name, power] : transaction._gate_power) {
+    if(auto itr = _gates.find(name); itr != _gates.end()) {
+      _replace_power(itr->second._power, power);
+    }
+  }
+
+  for(const auto& [name, power] : transaction._net_power) {
+    if(auto itr = _nets.find(name); itr != _nets.end()) {
+      _replace_power(itr->second._power, power);
+    }
+  }
+
+  // the timing is up-to-date again, except the derived endpoints, area and power
+  _clear_frontiers();
+  _remove_state();
+}
+
+// Procedure: _save_timing
+// Save the timing values of the propagation candidates before an update.
+void Timer::_save_timing() {
+
+  for(auto pin : _fprop_cands) {
+    _save_timing(*pin);
+  }
+
+  for(auto pin : _bprop_cands) {
+    _save_timing(*pin);
+  }
+}
+
+// Procedure: _save_timing
+// Save the timing values of the pins of a net before an edit on the net.
+void Timer::_save_timing(Net& net) {
+  for(auto pin : net._pins) {
+    _save_timing(*pin);
+  }
+}
+
+// Procedure: _save_timing
+// Save the timing values of a pin, its fanin arcs and its tests unless they are saved.
+void Timer::_save_timing(Pin& pin) {
+
+  auto [itr, inserted] = _transaction->_timing.try_emplace(pin._name);
+
+  if(!inserted) {
+    return;
+  }
+
+  auto& timing = itr->second;
+
+  auto save = [&pin] (const auto& v) -> std::optional<Transaction::Value> {
+    if(!v) {
+      return std::nullopt;
+    }
+    auto arc = v->pi_arc;
+    if(!arc) {
+      return Transaction::Value {"", false, 0, v->pi_el, v->pi_rf, v->numeric};
+    }
+    auto fanout = &(arc->_from) == &pin;
+    auto& peer = fanout ? arc->_to : arc->_from;
+    size_t nth = 0;
+    for(auto a : (fanout ? pin._fanout : pin._fanin)) {
+      if(a == arc) {
+        break;
+      }
+      if(&(fanout ? a->_to : a->_from) == &peer) {
+        ++nth;
+      }
+    }
+    return Transaction::Value {peer._name, fanout, nth, v->pi_el, v->pi_rf, v->numeric};
+  };
+
+  FOR_EACH_EL_RF(el, rf) {
+    timing.slew[el][rf] = save(pin._slew[el][rf]);
+    timing.at[el][rf]   = save(pin._at[el][rf]);
+    timing.rat[el][rf]  = save(pin._rat[el][rf]);
+  }
+
+  timing.fanin.reserve(pin._fanin.size());
+
+  for(auto arc : pin._fanin) {
+    timing.fanin.push_back({arc->_from._name, arc->_delay});
+  }
+
+  timing.tests.reserve(pin._tests.size());
+
+  for(auto test : pin._tests) {
+    timing.tests.push_back({
+      test->_arc._from._name, test->_rat, test->_cppr_credit, test->_constraint,
+      test->_related_at
+    });
+  }
+
+  if(_power_analysis) {
+    timing.activity = pin._activity;
+    if(pin._gate) {
+      _transaction->_gate_power.try_emplace(pin._gate->_name, pin._gate->_power);
+    }
+    if(pin._net) {
+      _transaction->_net_power.try_emplace(pin._net->_name, pin._net->_power);
+    }
+  }
+}
+
+// Procedure: _restore_timing
+void Timer::_restore_timing(Pin& pin, const Transaction::PinTiming& timing) {
+
+  // the nth arc between the pin and a peer
+  auto find_arc = [&] (const Transaction::Value& v) -> Arc* {
+    if(v.peer.empty()) {
+      return nullptr;
+    }
+    size_t nth = 0;
+    for(auto arc : (v.fanout ? pin._fanout : pin._fanin)) {
+      if((v.fanout ? arc->_to : arc->_from)._name == v.peer && nth++ == v.nth) {
+        return arc;
+      }
+    }
+    return nullptr;
+  };
+
+  FOR_EACH_EL_RF(el, rf) {
+    if(const auto& v = timing.slew[el][rf]; v) {
+      pin._slew[el][rf].emplace(find_arc(*v), v->el, v->rf, v->numeric);
+    }
+    else {
+      pin._slew[el][rf].reset();
+    }
+    if(const auto& v = timing.at[el][rf]; v) {
+      pin._at[el][rf].emplace(find_arc(*v), v->el, v->rf, v->numeric);
+    }
+    else {
+      pin._at[el][rf].reset();
+    }
+    if(const auto& v = timing.rat[el][rf]; v) {
+      pin._rat[el][rf].emplace(find_arc(*v), v->el, v->rf, v->numeric);
+    }
+    else {
+      pin._rat[el][rf].reset();
+    }
+  }
+
+  // a pin may have several arcs (or tests) from the same pin, e.g., one arc for each timing
+  // split or the setup and hold tests, which are matched in the order they were saved
+  std::vector<bool> matched(timing.fanin.size(), false);
+
+  for(auto arc : pin._fanin) {
+    auto itr = timing.fanin.begin();
+    for(; itr != timing.fanin.end(); ++itr) {
+      if(!matched[itr - timing.fanin.begin()] && itr->from == arc->_from._name) {
+        break;
+      }
+    }
+    if(itr != timing.fanin.end()) {
+      matched[itr - timing.fanin.begin()] = true;
+      arc->_delay = itr->delay;
+    }
+  }
+
+  matched.assign(timing.tests.size(), false);
+
+  for(auto test : pin._tests) {
+    auto itr = timing.tests.begin();
+    for(; itr != timing.tests.end(); ++itr) {
+      if(!matched[itr - timing.tests.begin()] && itr->related == test->_arc._from._name) {
+        break;
+      }
+    }
+    if(itr != timing.tests.end()) {
+      matched[itr - timing.tests.begin()] = true;
+      test->_rat         = itr->rat;
+      test->_cppr_credit = itr->cppr_credit;
+      test->_constraint  = itr->constraint;
+      test->_related_at  = itr->related_at;
+    }
+  }
+
+  pin._activity = timing.activity;
+
+  // the rc timing of the net is recomputed by the next propagation through the net
+  if(pin._net) {
+    pin._net->_rc_timing_updated = false;
+  }
+}
+
+// Procedure: _record_gate
+// Log the undo of an edit on a gate (insert, remove or repower): the gate is restored to
+// its current cell and connections, or removed if it does not exist yet.
+void Timer::_record_gate(const std::string& name) {
+
+  if(!_transaction) {
+    return;
+  }
+
+  std::optional<std::string> cell;
+  std::vector<std::pair<std::string, std::string>> connections;
+
+  if(auto itr = _gates.find(name); itr != _gates.end()) {
+    auto& gate = itr->second;
+    cell = gate.cell_name();
+    for(auto pin : gate._pins) {
+      _save_timing(*pin);
+      if(pin->_net) {
+        _save_timing(*pin->_net);
+        connections.emplace_back(pin->_name, pin->_net->_name);
+      }
+    }
+  }
+
+  _transaction->_undos.push_back([this, name, cell=std::move(cell),
+                                  connections=std::move(connections)] () {
+
+    auto itr = _gates.find(name);
+
+    // inserted within the transaction
+    if(!cell) {
+      if(itr != _gates.end()) {
+        _remove_gate(itr->second);
+      }
+      return;
+    }
+
+    // repowered within the transaction
+    if(itr != _gates.end()) {
+      if(itr->second.cell_name() != *cell) {
+        _repower_gate(name, *cell);
+      }
+      return;
+    }
+
+    // removed within the transaction
+    _insert_gate(name, *cell);
+
+    for(const auto& [pin, net] : connections) {
+      auto p = _pins.find(pin);
+      auto n = _nets.find(net);
+      if(p != _pins.end() && n != _nets.end()) {
+        _connect_pin(p->second, n->second);
+      }
+    }
+  });
+}
+
+// Procedure: _record_insert_net
+// Log the undo of a net insertion.
+void Timer::_record_insert_net(const std::string& name) {
+
+  if(!_transaction || _nets.find(name) != _nets.end()) {
+    return;
+  }
+
+  _transaction->_undos.push_back([this, name] () {
+    if(auto itr = _nets.find(name); itr != _nets.end()) {
+      _remove_net(itr->second);
+    }
+  });
+}
+
+// Procedure: _record_remove_net
+// Log the undo of a net removal. The parasitics of the net are moved to the undo log.
+void Timer::_record_remove_net(const std::string& name) {
+
+  if(!_transaction) {
+    return;
+  }
+
+  auto itr = _nets.find(name);
+
+  if(itr == _nets.end()) {
+    return;
+  }
+
+  auto& net = itr->second;
+
+  _save_timing(net);
+
+  std::vector<std::string> pins;
+
+  for(auto pin : net._pins) {
+    pins.push_back(pin->_name);
+  }
+
+  auto rct = std::make_shared<decltype(net._rct)>(std::move(net._rct));
+
+  _transaction->_undos.push_back([this, name, pins=std::move(pins), rct,
+                                  hash=net._spef_hash] () {
+    auto& net = _insert_net(name);
+    net._rct = std::move(*rct);
+    net._spef_hash = hash;
+    net._rc_timing_updated = false;
+    for(const auto& pin : pins) {
+      if(auto itr = _pins.find(pin); itr != _pins.end()) {
+        _connect_pin(itr->second, net);
+      }
+    }
+  });
+}
+
+// Procedure: _record_pin
+// Log the undo of connecting a pin to a net or disconnecting a pin: the pin is reconnected
+// to its current net, if any.
+void Timer::_record_pin(const std::string& name, const std::string& to) {
+
+  if(!_transaction) {
+    return;
+  }
+
+  auto itr = _pins.find(name);
+
+  if(itr == _pins.end()) {
+    return;
+  }
+
+  auto& pin = itr->second;
+
+  _save_timing(pin);
+
+  if(pin._net) {
+    _save_timing(*pin._net);
+  }
+
+  if(auto n = _nets.find(to); n != _nets.end()) {
+    _save_timing(n->second);
+  }
+
+  _transaction->_undos.push_back([this, name, net=pin._net ? pin._net->_name : ""s] () {
+    if(auto itr = _pins.find(name); itr != _pins.end()) {
+      _disconnect_pin(itr->second);
+      if(auto n = _nets.find(net); n != _nets.end()) {
+        _connect_pin(itr->second, n->second);
+      }
+    }
+  });
+}
+
+// Procedure: _record_port
+// Log the undo of setting a constraint (at, slew, rat, load or switching activity) of a port.
+void Timer::_record_port(const std::string& name) {
+
+  if(!_transaction) {
+    return;
+  }
+
+  if(auto itr = _pis.find(name); itr != _pis.end()) {
+    _transaction->_undos.push_back([this, name, at=itr->second._at,
+                                    slew=itr->second._slew,
+                                    activity=itr->second._activity] () {
+      auto& pi = _pis.at(name);
+      FOR_EACH_EL_RF(el, rf) {
+        _set_at(pi, el, rf, at[el][rf]);
+        _set_slew(pi, el, rf, slew[el][rf]);
+      }
+      _set_switching_activity(pi, activity);
+    });
+  }
+  else if(auto itr = _pos.find(name); itr != _pos.end()) {
+    _transaction->_undos.push_back([this, name, rat=itr->second._rat,
+                                    load=itr->second._load] () {
+      auto& po = _pos.at(name);
+      FOR_EACH_EL_RF(el, rf) {
+        _set_rat(po, el, rf, rat[el][rf]);
+        _set_load(po, el, rf, load[el][rf]);
+      }
+    });
+  }
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,69 @@
+#ifndef OT_TIMER_TRANSACTION_HPP_
+#define OT_TIMER_TRANSACTION_HPP_
+
+#include <ot/timer/power.hpp>
+
+namespace ot {
+
+// Class: Transaction
+// The undo log of the operations applied within a transaction, and the timing values of each
+// pin (and its fanin arcs and tests) before the transaction changed them. The values of a pin
+// are saved once, right before the first update or edit within the transaction that touches
+// the pin, such that a rollback restores them without any propagation.
+//
+// Arcs are rebuilt by some edits (e.g., repower_gate), so an arc is referred to by the names
+// of its two pins (and its order among the arcs between them) rather than by its address.
+class Transaction {
+
+  friend class Timer;
+
+  // Struct: Value
+  // An at, slew or rat value and the arc it comes from.
+  struct Value {
+    std::string peer;     // the pin at the other end of the arc (empty if none)
+    bool fanout;          // whether the arc is a fanout arc of the pin
+    size_t nth;           // the arc among the arcs between the pin and the peer
+    Split el;
+    Tran  rf;
+    float numeric;
+  };
+
+  // Struct: ArcTiming
+  struct ArcTiming {
+    std::string from;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN> delay;
+  };
+
+  // Struct: TestTiming
+  struct TestTiming {
+    std::string related;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> rat;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> cppr_credit;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> constraint;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> related_at;
+  };
+
+  // Struct: PinTiming
+  struct PinTiming {
+    TimingData<std::optional<Value>, MAX_SPLIT, MAX_TRAN> slew;
+    TimingData<std::optional<Value>, MAX_SPLIT, MAX_TRAN> at;
+    TimingData<std::optional<Value>, MAX_SPLIT, MAX_TRAN> rat;
+    std::vector<ArcTiming> fanin;
+    std::vector<TestTiming> tests;
+    std::optional<Activity> activity;
+  };
+
+  bool _reversible {true};
+
+  std::vector<std::function<void()>> _undos;
+
+  std::unordered_map<std::string, PinTiming> _timing;
+
+  // the power of the gates and nets of the pins saved (power analysis)
+  std::unordered_map<std::string, Power> _gate_power;
+  std::unordered_map<std::string, Power> _net_power;
+};
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
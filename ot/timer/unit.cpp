@@ -46,8 +46,17 @@ void Timer::_to_time_unit(const second_t& unit) {
     kvp.second._scale_time(s);
   }
 
+  // scale the default toggle rate
+  if(_default_activity) {
+    _default_activity->toggle_rate /= s;
+  }
+
   // library time
   FOR_EACH_EL_IF(el, _celllib[el]) {
+    if(_celllib[el].use_count() > 1) {
+      OT_LOGE("can't rescale the ", to_string(el), " celllib shared with a forked timer");
+      continue;
+    }
     _celllib[el]->scale_time(s);
   }
   
@@ -94,6 +103,10 @@ void Timer::_to_capacitance_unit(const farad_t& unit) {
 
   // library capacitance
   FOR_EACH_EL_IF(el, _celllib[el]) {
+    if(_celllib[el].use_count() > 1) {
+      OT_LOGE("can't rescale the ", to_string(el), " celllib shared with a forked timer");
+      continue;
+    }
     _celllib[el]->scale_capacitance(s);
   }
   
@@ -135,6 +148,10 @@ void Timer::_to_resistance_unit(const ohm_t& unit) {
   
   // library resistance
   FOR_EACH_EL_IF(el, _celllib[el]) {
+    if(_celllib[el].use_count() > 1) {
+      OT_LOGE("can't rescale the ", to_string(el), " celllib shared with a forked timer");
+      continue;
+    }
     _celllib[el]->scale_resistance(s);
   }
   
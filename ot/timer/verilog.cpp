@@ -4,64 +4,234 @@ namespace ot {
 
 // Function: read_verilog
 Timer& Timer::read_verilog(std::filesystem::path path) {
-  
-  // Create a verilog module
-  auto module = std::make_shared<vlog::Module>();
+
+  // Create a verilog netlist
+  auto netlist = std::make_shared<vlog::Netlist>();
 
   std::scoped_lock lock(_mutex);
 
-  auto parser = _taskflow.emplace([module, path=std::move(path)] () {
+  auto parser = _taskflow.emplace([netlist, path=std::move(path)] (tf::Subflow& sf) {
     OT_LOGI("loading netlist ", path);
-    *module = vlog::read_verilog(path);
+    *netlist = vlog::read_verilog(path, sf);
   });
 
   // reader
-  auto reader = _taskflow.emplace([this, module] () mutable {
-    _verilog(*module);
-    OT_LOGI("added ", module->info());
+  auto reader = _taskflow.emplace([this, netlist] (tf::Subflow& sf) mutable {
+    _verilog(*netlist, sf);
+    OT_LOGI("added ", netlist->info());
   });
 
   // Build the task dependency
   parser.precede(reader);
 
   _add_to_lineage(reader);
-  
+
   return *this;
 }
 
+// Function: insert_netlist
+// Build the circuit from an in-memory netlist in one task. Unlike the per-object builders
+// (insert_gate, connect_pin, etc.), the objects of the netlist are added to the lineage as
+// a whole and are resolved in parallel.
+Timer& Timer::insert_netlist(vlog::Netlist netlist) {
+
+  std::scoped_lock lock(_mutex);
+
+  auto task = _taskflow.emplace([this, netlist=std::move(netlist)] (tf::Subflow& sf) mutable {
+    _verilog(netlist, sf);
+    OT_LOGI("added ", netlist.info());
+  });
+
+  _add_to_lineage(task);
+
+  return *this;
+}
+
+// Function: insert_netlist
+// Build the circuit from an in-memory flat module.
+Timer& Timer::insert_netlist(vlog::Module module) {
+  vlog::Netlist netlist;
+  netlist.modules.push_back(std::move(module));
+  return insert_netlist(std::move(netlist));
+}
+
 // Procedure: _verilog
-// Update the circuit from a given verilog module.
-void Timer::_verilog(vlog::Module& module) {
+// Update the circuit from a given verilog netlist. The top module is elaborated through the
+// shared module descriptions: the objects of an instance u1 of a module are named by the
+// hierarchical path of the instance (e.g., gate u1/u2, pin u1/u2:A, net u1/n1), and a port
+// of the module is the net connected to the instance in the parent module.
+void Timer::_verilog(vlog::Netlist& netlist, tf::Subflow& sf) {
+
+  auto top = netlist.top();
+
+  if(top == nullptr) {
+    OT_LOGE("top module not found (recursive instantiation)");
+    return;
+  }
+
+  std::unordered_map<std::string_view, const vlog::Module*> modules;
+
+  for(const auto& m : netlist.modules) {
+    modules.try_emplace(m.name, &m);
+  }
+
+  // Scope: an instance of a module with the parent nets bound to its ports
+  struct Scope {
+    std::string path;
+    std::unordered_map<std::string_view, std::string> ports;
+    std::string net(const std::string& name) const {
+      auto itr = ports.find(name);
+      return itr == ports.end() ? path + name : itr->second;
+    }
+  };
+
+  // Leaf: a library-cell gate in a scope
+  struct Leaf {
+    const vlog::Gate* gate;
+    const Scope* scope;
+  };
+
+  std::list<Scope> scopes;
+  std::vector<Leaf> leaves;
+  std::vector<std::string> wires;
+  std::vector<const vlog::Module*> stack;
+
+  // Step 0: Elaborate the hierarchy (depth first) to the leaf gates and the nets of the
+  // instances. Only names of the instances are built; the modules are not copied.
+  auto elaborate = [&] (auto&& self, const vlog::Module& module, const Scope& scope) -> void {
+
+    if(std::find(stack.begin(), stack.end(), &module) != stack.end()) {
+      OT_LOGE("module ", module.name, " instantiates itself");
+      return;
+    }
+
+    stack.push_back(&module);
+
+    for(const auto& gate : module.gates) {
+
+      if(auto itr = modules.find(gate.cell); itr == modules.end()) {
+        leaves.push_back({&gate, &scope});
+        continue;
+      }
+      else {
+
+        const auto& sub = *(itr->second);
+        auto& inst = scopes.emplace_back();
+
+        inst.path = scope.path + gate.name + '/';
+
+        // a port of the submodule is the connected net in the parent, and unconnected
+        // ports are local to the instance
+        for(const auto& port : sub.ports) {
+          if(auto p = gate.cellpin2net.find(port); p != gate.cellpin2net.end()) {
+            inst.ports.try_emplace(port, scope.net(p->second));
+          }
+          else {
+            wires.push_back(inst.path + port);
+          }
+        }
+
+        for(const auto& wire : sub.wires) {
+          if(inst.ports.find(wire) == inst.ports.end()) {
+            wires.push_back(inst.path + wire);
+          }
+        }
+
+        self(self, sub, inst);
+      }
+    }
+
+    stack.pop_back();
+  };
+
+  elaborate(elaborate, *top, scopes.emplace_back());
+
+  // Pre-size the pin, net, and gate maps from the elaborated counts (one pin per
+  // connection) to avoid rehashing while the design grows.
+  size_t num_ports = top->inputs.size() + top->outputs.size();
+  size_t num_pins = num_ports;
+
+  for(const auto& leaf : leaves) {
+    num_pins += leaf.gate->cellpin2net.size();
+  }
+
+  _pins.reserve(_pins.size() + num_pins);
+  _nets.reserve(_nets.size() + num_ports + top->wires.size() + wires.size());
+  _gates.reserve(_gates.size() + leaves.size());
 
   // Step 1: Scan the primary input and create a pin for each primary input port.
   // Each primary input is automatically connected to a net whose name is the same
   // as the name of the primary input.
-  for(const auto& pi : module.inputs) {
+  for(const auto& pi : top->inputs) {
     _insert_primary_input(pi);
   }
-  
+
   // Step 2: Scan the primary output and create a pin for each primary output port.
   // Each primary output is automatically connected to a net whose name is the same
   // as the name of the primary output.
-  for(const auto& po : module.outputs) {
+  for(const auto& po : top->outputs) {
     _insert_primary_output(po);
   }
-  
-  // Step 3: Scan the wires and insert a net for each wire. Each wire is automatically
-  // attached to a net. The connection of each net is specified by the gates.
-  for(const auto& wire : module.wires) {
+
+  // Step 3: Scan the wires and insert a net for each wire (of the top module and of each
+  // instance). The connection of each net is specified by the gates.
+  for(const auto& wire : top->wires) {
+    _insert_net(wire);
+  }
+
+  for(const auto& wire : wires) {
     _insert_net(wire);
   }
-  
-  // Step 4: Scan the gate through verilog file. Insert a new gate for each gate
-  // being iterated and a set of pins corresponding to each cellpin of the gate. Then,
-  // for each pin-net mapping specified in the gate, connect the pin to the net.
-  for(const auto& gate : module.gates) {
-    _insert_gate(gate.name, gate.cell);
-    for(const auto& [c, n] : gate.cellpin2net) {
-      auto& pin = _insert_pin(gate.name + ':' + c);
-      auto& net = _insert_net(n); 
-      _connect_pin(pin, net);
+
+  if(leaves.empty()) {
+    return;
+  }
+
+  OT_LOGE_RIF(!_celllib[MIN] || !_celllib[MAX], "celllib not found");
+
+  // Step 4: Resolve the cell, the pin names, and the nets of each gate in parallel.
+  // Nothing is inserted at this step such that the maps can be read concurrently.
+  struct Connection {
+    std::string pin;
+    std::string net_name;
+    Net* net;
+  };
+
+  std::vector<CellView> cells(leaves.size());
+  std::vector<std::string> names(leaves.size());
+  std::vector<std::vector<Connection>> connections(leaves.size());
+
+  sf.for_each_index(size_t{0}, leaves.size(), size_t{1}, [&] (size_t i) {
+    const auto& [gate, scope] = leaves[i];
+    cells[i] = {_celllib[MIN]->cell(gate->cell), _celllib[MAX]->cell(gate->cell)};
+    names[i] = scope->path + gate->name;
+    connections[i].reserve(gate->cellpin2net.size());
+    for(const auto& [c, n] : gate->cellpin2net) {
+      auto net = scope->net(n);
+      auto itr = _nets.find(net);
+      connections[i].push_back({
+        names[i] + ':' + c, std::move(net), itr == _nets.end() ? nullptr : &(itr->second)
+      });
+    }
+  });
+
+  sf.join();
+
+  // Step 5: Insert a new gate for each gate being iterated and a set of pins corresponding
+  // to each cellpin of the gate. Then, for each pin-net mapping specified in the gate,
+  // connect the pin to the net (implicit nets are inserted on the fly).
+  for(size_t i=0; i<leaves.size(); ++i) {
+
+    if(!cells[i][MIN] || !cells[i][MAX]) {
+      OT_LOGE("cell ", leaves[i].gate->cell, " not found in celllib");
+    }
+    else {
+      _insert_gate(names[i], cells[i]);
+    }
+
+    for(auto& [p, net_name, net] : connections[i]) {
+      auto& pin = _insert_pin(p);
+      _connect_pin(pin, net ? *net : _insert_net(net_name));
     }
   }
 }
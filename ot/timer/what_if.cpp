@@ -0,0 +1,232 @@
+#include <ot/timer/timer.hpp>
+
+namespace ot {
+
+// Function: what_if_repower
+// Estimate the local timing changes of repowering a gate with a footprint-compatible cell
+// without changing the timer. The query holds only a shared lock after the timing is updated,
+// such that many candidates can be evaluated concurrently.
+std::optional<RepowerEstimate> Timer::what_if_repower(
+  const std::string& gate, const std::string& cell
+) {
+
+  {
+    std::scoped_lock lock(_mutex);
+    _update_timing();
+  }
+
+  std::shared_lock lock(_mutex);
+
+  return _what_if_repower(gate, cell);
+}
+
+// Function: _what_if_repower
+std::optional<RepowerEstimate> Timer::_what_if_repower(
+  const std::string& gname, const std::string& cname
+) const {
+
+  if(!_celllib[MIN] || !_celllib[MAX]) {
+    OT_LOGE("celllib not found");
+    return std::nullopt;
+  }
+
+  auto gitr = _gates.find(gname);
+
+  if(gitr == _gates.end()) {
+    OT_LOGE("gate ", gname, " not found");
+    return std::nullopt;
+  }
+
+  auto cell = CellView {_celllib[MIN]->cell(cname), _celllib[MAX]->cell(cname)};
+
+  if(!cell[MIN] || !cell[MAX]) {
+    OT_LOGE("cell ", cname, " not found");
+    return std::nullopt;
+  }
+
+  const auto& gate = gitr->second;
+  auto tvs = _isomorphic_timing_views(gate, cell);
+
+  if(!tvs) {
+    OT_LOGW("cell ", cname, " is not footprint-compatible with gate ", gname);
+    return std::nullopt;
+  }
+
+  RepowerEstimate estimate;
+
+  // the capacitance of a cellpin (see Pin::cap)
+  auto cap = [] (const Cellpin& cp, Tran rf) {
+    if(rf == RISE && cp.rise_capacitance) {
+      return *cp.rise_capacitance;
+    }
+    else if(rf == FALL && cp.fall_capacitance) {
+      return *cp.fall_capacitance;
+    }
+    return cp.capacitance ? *cp.capacitance : 0.0f;
+  };
+
+  // the changes of the arrival time at the gate pins
+  std::unordered_map<const Pin*, TimingData<float, MAX_SPLIT, MAX_TRAN>> dat;
+
+  // Step 1: the load change of each input net and the delay change of its driver
+  std::unordered_map<const Net*, TimingData<float, MAX_SPLIT, MAX_TRAN>> dload;
+
+  for(auto pin : gate._pins) {
+    if(pin->is_output() || !pin->_net || !pin->_net->_root) {
+      continue;
+    }
+    auto& dl = dload[pin->_net];
+    FOR_EACH_EL_RF(el, rf) {
+      dl[el][rf] += cap(*cell[el]->cellpin(pin->cellpin(el)->name), rf) - pin->cap(el, rf);
+    }
+  }
+
+  for(const auto& [net, dl] : dload) {
+
+    const auto& root = *(net->_root);
+
+    TimingData<float, MAX_SPLIT, MAX_TRAN> dat_root {};
+
+    for(auto arc : root._fanin) {
+
+      auto tv = arc->timing_view();
+
+      if(!tv[MIN] && !tv[MAX]) {
+        continue;
+      }
+
+      auto& delta = estimate.arcs.emplace_back();
+
+      delta.from = arc->_from._name;
+      delta.to = root._name;
+
+      FOR_EACH_EL_RF_RF_IF(el, frf, trf, (tv[el] && arc->_from._slew[el][frf])) {
+
+        if(tv[el]->is_constraint()) {
+          continue;
+        }
+
+        auto si = *arc->_from._slew[el][frf];
+        auto lc = net->_load(el, trf);
+        auto od = tv[el]->delay(frf, trf, si, lc);
+        auto nd = tv[el]->delay(frf, trf, si, lc + dl[el][trf]);
+        auto os = tv[el]->slew(frf, trf, si, lc);
+        auto ns = tv[el]->slew(frf, trf, si, lc + dl[el][trf]);
+
+        if(od && nd) {
+          delta.delay[el][frf][trf] = *nd - *od;
+        }
+
+        if(os && ns) {
+          delta.slew[el][frf][trf] = *ns - *os;
+        }
+
+        // the arc the arrival time of the driver comes from
+        if(const auto& at = root._at[el][trf]; at && at->pi_arc == arc && at->pi_rf == frf) {
+          dat_root[el][trf] = delta.delay[el][frf][trf].value_or(0.0f);
+        }
+      }
+    }
+
+    // the rc delay of the net is taken unchanged
+    for(auto pin : gate._pins) {
+      if(pin->_net == net) {
+        dat[pin] = dat_root;
+      }
+    }
+  }
+
+  // Step 2: the delay and slew changes of the gate arcs at the current slews and loads
+  std::unordered_map<const Arc*, size_t> deltas;
+
+  for(size_t i=0; i<gate._arcs.size(); ++i) {
+
+    const auto arc = gate._arcs[i];
+    auto otv = arc->timing_view();
+    auto ntv = (*tvs)[i];
+
+    if(std::any_of(SPLIT.begin(), SPLIT.end(), [&] (auto el) {
+      return otv[el] && otv[el]->is_constraint();
+    })) {
+      continue;
+    }
+
+    deltas[arc] = estimate.arcs.size();
+
+    auto& delta = estimate.arcs.emplace_back();
+
+    delta.from = arc->_from._name;
+    delta.to = arc->_to._name;
+
+    FOR_EACH_EL_RF_RF_IF(el, frf, trf, (otv[el] && arc->_from._slew[el][frf])) {
+
+      auto si = *arc->_from._slew[el][frf];
+      auto lc = arc->_to._net ? arc->_to._net->_load(el, trf) : 0.0f;
+      auto od = otv[el]->delay(frf, trf, si, lc);
+      auto nd = ntv[el]->delay(frf, trf, si, lc);
+      auto os = otv[el]->slew(frf, trf, si, lc);
+      auto ns = ntv[el]->slew(frf, trf, si, lc);
+
+      if(od && nd) {
+        delta.delay[el][frf][trf] = *nd - *od;
+      }
+
+      if(os && ns) {
+        delta.slew[el][frf][trf] = *ns - *os;
+      }
+    }
+  }
+
+  // Step 3: the arrival time changes at the output pins along the arcs they come from
+  for(auto pin : gate._pins) {
+
+    if(!pin->is_output()) {
+      continue;
+    }
+
+    auto& dpin = dat[pin];
+
+    FOR_EACH_EL_RF_IF(el, rf, pin->_at[el][rf]) {
+
+      const auto& at = *(pin->_at[el][rf]);
+
+      if(auto itr = deltas.find(at.pi_arc); itr != deltas.end()) {
+        const auto& d = estimate.arcs[itr->second].delay[at.pi_el][at.pi_rf][rf];
+        auto from = dat.find(&(at.pi_arc->_from));
+        dpin[el][rf] = d.value_or(0.0f) +
+                       (from == dat.end() ? 0.0f : from->second[at.pi_el][at.pi_rf]);
+      }
+    }
+  }
+
+  // Step 4: the slack changes, where the required arrival time at an input pin changes with
+  // the delay of the arc it comes from (the required arrival times at the output pins are
+  // taken unchanged)
+  for(auto pin : gate._pins) {
+
+    auto& delta = estimate.pins.emplace_back();
+
+    delta.pin = pin->_name;
+
+    auto itr = dat.find(pin);
+
+    FOR_EACH_EL_RF_IF(el, rf, pin->_at[el][rf] && pin->_rat[el][rf]) {
+
+      auto d_at = (itr == dat.end()) ? 0.0f : itr->second[el][rf];
+      auto d_rat = 0.0f;
+
+      const auto& rat = *(pin->_rat[el][rf]);
+
+      if(auto ditr = deltas.find(rat.pi_arc); ditr != deltas.end()) {
+        d_rat = -estimate.arcs[ditr->second].delay[el][rf][rat.pi_rf].value_or(0.0f);
+      }
+
+      // slack is rat - at for late and at - rat for early
+      delta.slack[el][rf] = (el == MIN) ? d_at - d_rat : d_rat - d_at;
+    }
+  }
+
+  return estimate;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,37 @@
+#ifndef OT_TIMER_WHAT_IF_HPP_
+#define OT_TIMER_WHAT_IF_HPP_
+
+#include <ot/headerdef.hpp>
+
+namespace ot {
+
+// Struct: RepowerEstimate
+// The local timing changes of repowering a gate (see Timer::what_if_repower), evaluated from
+// the current slews and loads without any propagation. The changes are new minus current.
+struct RepowerEstimate {
+
+  // Struct: ArcDelta
+  // The delay and the output slew changes of a cell arc of the gate or of a driver of its
+  // input nets (whose load changes with the input capacitance of the gate).
+  struct ArcDelta {
+    std::string from;
+    std::string to;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN> delay;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN, MAX_TRAN> slew;
+  };
+
+  // Struct: PinDelta
+  // The estimated slack change at a pin of the gate, along the arcs the arrival time comes
+  // from.
+  struct PinDelta {
+    std::string pin;
+    TimingData<std::optional<float>, MAX_SPLIT, MAX_TRAN> slack;
+  };
+
+  std::vector<ArcDelta> arcs;
+  std::vector<PinDelta> pins;
+};
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,305 @@
+#include <ot/utility/compress.hpp>
+#include <ot/static/logger.hpp>
+#include <ot/config.hpp>
+#include <ot/taskflow/taskflow.hpp>
+#include <ot/taskflow/algorithm/pipeline.hpp>
+#include <fstream>
+#include <climits>
+#include <array>
+
+#ifdef OT_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OT_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+namespace ot {
+
+// Function: compression
+Compression compression(const std::filesystem::path& path) {
+
+  unsigned char magic[4] = {0, 0, 0, 0};
+
+  if(std::ifstream ifs(path, std::ios::binary); ifs) {
+    ifs.read(reinterpret_cast<char*>(magic), sizeof(magic));
+  }
+
+  if(magic[0] == 0x1f && magic[1] == 0x8b) {
+    return Compression::GZIP;
+  }
+  
+  if(magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+    return Compression::ZSTD;
+  }
+
+  return Compression::NONE;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Class: Decoder
+// Pull-based reader that yields the decompressed content of a file piece by piece.
+class Decoder {
+
+  public:
+
+    Decoder(const std::filesystem::path&);
+    ~Decoder();
+
+    inline bool good() const;
+
+    size_t read(char*, size_t);
+
+  private:
+
+    Compression _type {Compression::NONE};
+
+    bool _good {false};
+
+    std::ifstream _ifs;
+
+#ifdef OT_WITH_ZLIB
+    gzFile _gz {nullptr};
+#endif
+
+#ifdef OT_WITH_ZSTD
+    ZSTD_DCtx* _zstd {nullptr};
+    std::vector<char> _in;
+    ZSTD_inBuffer _zin {nullptr, 0, 0};
+#endif
+};
+
+// Constructor
+Decoder::Decoder(const std::filesystem::path& path) : _type {compression(path)} {
+
+  switch(_type) {
+
+    case Compression::GZIP:
+#ifdef OT_WITH_ZLIB
+      _gz = ::gzopen(path.c_str(), "rb");
+      if(_gz) {
+        ::gzbuffer(_gz, 1 << 18);
+      }
+      _good = (_gz != nullptr);
+#else
+      OT_LOGE("can't read gzip file ", path, " (built without zlib)");
+#endif
+    break;
+
+    case Compression::ZSTD:
+#ifdef OT_WITH_ZSTD
+      _ifs.open(path, std::ios::binary);
+      _zstd = ::ZSTD_createDCtx();
+      _in.resize(::ZSTD_DStreamInSize());
+      _good = _ifs.good() && _zstd != nullptr;
+#else
+      OT_LOGE("can't read zstd file ", path, " (built without zstd)");
+#endif
+    break;
+
+    default:
+      _ifs.open(path, std::ios::binary);
+      _good = _ifs.good();
+    break;
+  }
+}
+
+// Destructor
+Decoder::~Decoder() {
+#ifdef OT_WITH_ZLIB
+  if(_gz) {
+    ::gzclose(_gz);
+  }
+#endif
+
+#ifdef OT_WITH_ZSTD
+  if(_zstd) {
+    ::ZSTD_freeDCtx(_zstd);
+  }
+#endif
+}
+
+// Function: good
+inline bool Decoder::good() const {
+  return _good;
+}
+
+// Function: read
+// Decompress up to N bytes into the given buffer and return the number of bytes written.
+// A return value of zero denotes the end of the file (or an error).
+size_t Decoder::read(char* out, size_t N) {
+
+  if(!_good || N == 0) {
+    return 0;
+  }
+
+  switch(_type) {
+
+    case Compression::GZIP:
+#ifdef OT_WITH_ZLIB
+      if(auto n = ::gzread(_gz, out, std::min<size_t>(N, INT_MAX)); n >= 0) {
+        return n;
+      }
+      _good = false;
+#endif
+    break;
+
+    case Compression::ZSTD:
+#ifdef OT_WITH_ZSTD
+    {
+      ZSTD_outBuffer zout {out, N, 0};
+      while(zout.pos == 0) {
+        if(_zin.pos == _zin.size) {
+          _ifs.read(_in.data(), _in.size());
+          if(_ifs.gcount() == 0) {
+            break;
+          }
+          _zin = {_in.data(), static_cast<size_t>(_ifs.gcount()), 0};
+        }
+        if(::ZSTD_isError(::ZSTD_decompressStream(_zstd, &zout, &_zin))) {
+          _good = false;
+          break;
+        }
+      }
+      return zout.pos;
+    }
+#endif
+    break;
+
+    default:
+      _ifs.read(out, N);
+      return _ifs.gcount();
+    break;
+  }
+
+  return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Function: decompress
+std::optional<std::string> decompress(const std::filesystem::path& path) {
+
+  Decoder decoder(path);
+
+  if(!decoder.good()) {
+    return std::nullopt;
+  }
+
+  std::string buffer;
+
+  for(size_t n = 1 << 20, size = 0; ; size = buffer.size()) {
+    buffer.resize(size + n);
+    auto r = decoder.read(buffer.data() + size, n);
+    buffer.resize(size + r);
+    if(r == 0) {
+      break;
+    }
+  }
+
+  if(!decoder.good()) {
+    return std::nullopt;
+  }
+
+  return buffer;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Constructor
+ChunkReader::ChunkReader(
+  const std::filesystem::path& path, 
+  std::function<size_t(std::string_view)> cut,
+  size_t chunk_size
+) :
+  _decoder    {std::make_unique<Decoder>(path)},
+  _cut        {std::move(cut)},
+  _chunk_size {chunk_size} {
+}
+
+// Destructor
+ChunkReader::~ChunkReader() = default;
+
+// Function: good
+bool ChunkReader::good() const {
+  return _decoder->good();
+}
+
+// Function: next
+// Read the next chunk up to its last whole record and return false at the end of the file.
+bool ChunkReader::next(std::string& chunk) {
+
+  chunk.swap(_carry);
+  _carry.clear();
+
+  // double the request size until the cutter finds a record boundary
+  for(size_t n = _chunk_size; !_eof; n <<= 1) {
+
+    auto size = chunk.size();
+    chunk.resize(size + n);
+    auto r = _decoder->read(chunk.data() + size, n);
+    chunk.resize(size + r);
+
+    if(r == 0) {
+      _eof = true;
+    }
+    else if(auto pos = _cut(chunk); pos) {
+      _carry.assign(chunk, pos);
+      chunk.resize(pos);
+      break;
+    }
+  }
+
+  return !chunk.empty();
+}
+
+// ------------------------------------------------------------------------------------------------
+
+// Function: read_chunks
+bool read_chunks(
+  const std::filesystem::path& path,
+  const std::function<size_t(std::string_view)>& cut,
+  const std::function<void(std::string&)>& consume,
+  size_t chunk_size
+) {
+
+  ChunkReader reader(path, cut, chunk_size);
+
+  if(!reader.good()) {
+    return false;
+  }
+
+  // two lines so decompression of a chunk overlaps with the parsing of the previous one
+  constexpr size_t num_lines = 2;
+
+  std::array<std::string, num_lines> chunks;
+
+  tf::Pipeline pipeline(num_lines,
+
+    // stage 1: read the next chunk
+    tf::Pipe{tf::PipeType::SERIAL, [&] (tf::Pipeflow& pf) {
+      if(!reader.next(chunks[pf.line()])) {
+        pf.stop();
+      }
+    }},
+
+    // stage 2: parse the chunk
+    tf::Pipe{tf::PipeType::SERIAL, [&] (tf::Pipeflow& pf) {
+      consume(chunks[pf.line()]);
+      chunks[pf.line()].clear();
+    }}
+  );
+  
+  // use a dedicated executor as the caller typically runs in a worker of the timer
+  tf::Taskflow taskflow;
+  tf::Executor executor(num_lines);
+
+  taskflow.composed_of(pipeline);
+  executor.run(taskflow).wait();
+
+  return reader.good();
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,75 @@
+#ifndef OT_UTILITY_COMPRESS_HPP_
+#define OT_UTILITY_COMPRESS_HPP_
+
+#include <string>
+#include <string_view>
+#include <optional>
+#include <memory>
+#include <functional>
+#include <filesystem>
+
+namespace ot {
+
+class Decoder;
+
+// Enum: Compression
+enum class Compression {
+  NONE = 0,
+  GZIP,
+  ZSTD
+};
+
+// Function: compression
+// Detect the compression format of a file from its magic number.
+Compression compression(const std::filesystem::path&);
+
+// Function: decompress
+// Decompress an entire file into memory. Suitable for inputs that cannot be parsed in pieces
+// (e.g., cell libraries).
+std::optional<std::string> decompress(const std::filesystem::path&);
+
+// Class: ChunkReader
+// Pull successive chunks of a (compressed) file. The cutter returns the length of the longest
+// prefix made of whole records (zero to ask for more data), and the rest is carried over to
+// the next chunk. Chunks are null-terminated and can be edited in place.
+class ChunkReader {
+
+  public:
+
+    ChunkReader(
+      const std::filesystem::path&, 
+      std::function<size_t(std::string_view)>, 
+      size_t = 1 << 24
+    );
+
+    ~ChunkReader();
+
+    bool good() const;
+    bool next(std::string&);
+
+  private:
+
+    std::unique_ptr<Decoder> _decoder;
+
+    std::function<size_t(std::string_view)> _cut;
+
+    size_t _chunk_size;
+
+    std::string _carry;
+
+    bool _eof {false};
+};
+
+// Function: read_chunks
+// Stream a file through a two-stage pipeline: while the consumer parses one chunk, a 
+// chunk reader decompresses the next one.
+bool read_chunks(
+  const std::filesystem::path&,
+  const std::function<size_t(std::string_view)>&,
+  const std::function<void(std::string&)>&,
+  size_t = 1 << 24
+);
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,108 @@
+#include <ot/utility/mmap.hpp>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ot {
+
+// Constructor
+MappedFile::MappedFile(const std::filesystem::path& path, bool writable) {
+  open(path, writable);
+}
+
+// Move constructor
+MappedFile::MappedFile(MappedFile&& rhs) {
+  *this = std::move(rhs);
+}
+
+// Destructor
+MappedFile::~MappedFile() {
+  close();
+}
+
+// Move assignment
+MappedFile& MappedFile::operator = (MappedFile&& rhs) {
+  if(this != &rhs) {
+    close();
+    _buffer = std::move(rhs._buffer);
+    _data   = _buffer.empty() ? rhs._data : _buffer.data();
+    _size   = rhs._size;
+    _mapped = rhs._mapped;
+    _open   = rhs._open;
+    rhs._data   = nullptr;
+    rhs._size   = 0;
+    rhs._mapped = 0;
+    rhs._open   = false;
+  }
+  return *this;
+}
+
+// Function: open
+// Map the file into memory. A file whose size is a multiple of the page size leaves no room
+// for the trailing null character and, similar to non-regular files, is read into a buffer.
+bool MappedFile::open(const std::filesystem::path& path, bool writable) {
+
+  close();
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+
+  if(fd == -1) {
+    return false;
+  }
+
+  struct stat st;
+
+  if(::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+     st.st_size % ::sysconf(_SC_PAGESIZE) != 0) {
+
+    auto prot = PROT_READ | (writable ? PROT_WRITE : 0);
+
+    if(auto ptr = ::mmap(nullptr, st.st_size, prot, MAP_PRIVATE, fd, 0); ptr != MAP_FAILED) {
+      ::madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+      _data   = static_cast<char*>(ptr);
+      _size   = st.st_size;
+      _mapped = st.st_size;
+      _open   = true;
+    }
+  }
+
+  ::close(fd);
+
+  // fall back to the stream-based read
+  if(!_open) {
+
+    std::ifstream ifs(path, std::ios::binary);
+
+    if(!ifs.good()) {
+      return false;
+    }
+
+    _buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    _size = _buffer.size();
+    _buffer.push_back(0);
+    _data = _buffer.data();
+    _open = true;
+  }
+
+  return true;
+}
+
+// Procedure: close
+void MappedFile::close() {
+
+  if(_mapped) {
+    ::munmap(_data, _mapped);
+  }
+
+  _buffer.clear();
+  _buffer.shrink_to_fit();
+
+  _data   = nullptr;
+  _size   = 0;
+  _mapped = 0;
+  _open   = false;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
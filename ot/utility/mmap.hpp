@@ -0,0 +1,77 @@
+#ifndef OT_UTILITY_MMAP_HPP_
+#define OT_UTILITY_MMAP_HPP_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <filesystem>
+
+namespace ot {
+
+// Class: MappedFile
+// Maps a file into memory as the shared input source of all readers.
+// The content is always followed by a null character so numeric conversions
+// (e.g., std::strtof) never run past the end of the file. A writable file is
+// mapped copy-on-write so in-place edits never reach the disk.
+class MappedFile {
+
+  public:
+
+    MappedFile() = default;
+    MappedFile(const std::filesystem::path&, bool = false);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&);
+
+    ~MappedFile();
+
+    MappedFile& operator = (const MappedFile&) = delete;
+    MappedFile& operator = (MappedFile&&);
+
+    bool open(const std::filesystem::path&, bool = false);
+    void close();
+
+    inline bool is_open() const;
+    inline size_t size() const;
+    inline char* data();
+    inline const char* data() const;
+    inline std::string_view view() const;
+
+  private:
+
+    char* _data {nullptr};
+    size_t _size {0};
+    size_t _mapped {0};
+
+    std::vector<char> _buffer;
+
+    bool _open {false};
+};
+
+// Function: is_open
+inline bool MappedFile::is_open() const {
+  return _open;
+}
+
+// Function: size
+inline size_t MappedFile::size() const {
+  return _size;
+}
+
+// Function: data
+inline char* MappedFile::data() {
+  return _data;
+}
+
+// Function: data
+inline const char* MappedFile::data() const {
+  return _data;
+}
+
+// Function: view
+inline std::string_view MappedFile::view() const {
+  return {_data, _size};
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,151 @@
+#include <ot/utility/pattern.hpp>
+#include <regex>
+
+namespace ot {
+
+// Function: is_pattern
+bool is_pattern(std::string_view name) {
+  return name.find_first_of("*?") != std::string_view::npos;
+}
+
+// Function: glob_match
+// Match a name against a glob pattern where * matches any sequence of characters
+// and ? matches any single character.
+bool glob_match(std::string_view pattern, std::string_view name) {
+
+  size_t p {0}, n {0};
+  size_t star {std::string_view::npos}, mark {0};
+
+  while(n < name.size()) {
+    if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+      ++p;
+      ++n;
+    }
+    else if(p < pattern.size() && pattern[p] == '*') {
+      star = p++;
+      mark = n;
+    }
+    else if(star != std::string_view::npos) {
+      p = star + 1;
+      n = ++mark;
+    }
+    else {
+      return false;
+    }
+  }
+
+  while(p < pattern.size() && pattern[p] == '*') {
+    ++p;
+  }
+
+  return p == pattern.size();
+}
+
+// Procedure: _sort
+void NameIndex::_sort() {
+
+  std::sort(_forward.begin(), _forward.end());
+
+  _backward = _forward;
+
+  std::sort(_backward.begin(), _backward.end(), [] (std::string_view a, std::string_view b) {
+    return std::lexicographical_compare(a.rbegin(), a.rend(), b.rbegin(), b.rend());
+  });
+
+  _valid = true;
+}
+
+// Function: match
+// Find the names matching a glob pattern or, if regex is true, a regular expression
+// (ECMAScript, matching the whole name).
+std::vector<std::string_view> NameIndex::match(std::string_view pattern, bool regex) const {
+  return regex ? _regex(pattern) : _glob(pattern);
+}
+
+// Function: _glob
+std::vector<std::string_view> NameIndex::_glob(std::string_view pattern) const {
+
+  std::vector<std::string_view> names;
+
+  auto f = pattern.find_first_of("*?");
+
+  // exact name
+  if(f == std::string_view::npos) {
+    if(std::binary_search(_forward.begin(), _forward.end(), pattern)) {
+      names.push_back(*std::lower_bound(_forward.begin(), _forward.end(), pattern));
+    }
+    return names;
+  }
+
+  auto prefix = pattern.substr(0, f);
+  auto suffix = pattern.substr(pattern.find_last_of("*?") + 1);
+
+  // names starting with the prefix
+  if(prefix.size() >= suffix.size()) {
+    auto beg = std::lower_bound(_forward.begin(), _forward.end(), prefix);
+    for(auto itr = beg; itr != _forward.end() && itr->substr(0, prefix.size()) == prefix; ++itr) {
+      if(glob_match(pattern, *itr)) {
+        names.push_back(*itr);
+      }
+    }
+  }
+  // names ending with the suffix
+  else {
+    auto ends_with = [&] (std::string_view s) {
+      return s.size() >= suffix.size() && s.substr(s.size() - suffix.size()) == suffix;
+    };
+    auto beg = std::lower_bound(_backward.begin(), _backward.end(), suffix,
+      [] (std::string_view a, std::string_view b) {
+        return std::lexicographical_compare(a.rbegin(), a.rend(), b.rbegin(), b.rend());
+      }
+    );
+    for(auto itr = beg; itr != _backward.end() && ends_with(*itr); ++itr) {
+      if(glob_match(pattern, *itr)) {
+        names.push_back(*itr);
+      }
+    }
+    std::sort(names.begin(), names.end());
+  }
+
+  return names;
+}
+
+// Function: _regex
+std::vector<std::string_view> NameIndex::_regex(std::string_view pattern) const {
+
+  std::vector<std::string_view> names;
+
+  // the literal prefix ends at the first meta character; a quantifier makes the
+  // preceding character optional and an alternation leaves no common prefix
+  size_t l {0};
+
+  if(!pattern.empty() && pattern[0] == '^') {
+    pattern.remove_prefix(1);
+  }
+
+  while(pattern.find('|') == std::string_view::npos && l < pattern.size() && 
+        std::string_view(".[]{}()*+?^$|\\").find(pattern[l]) == std::string_view::npos) {
+    ++l;
+  }
+
+  if(l < pattern.size() && l > 0 && std::string_view("*?{").find(pattern[l]) !=
+     std::string_view::npos) {
+    --l;
+  }
+
+  auto prefix = pattern.substr(0, l);
+
+  std::regex re(pattern.begin(), pattern.end());
+
+  auto beg = std::lower_bound(_forward.begin(), _forward.end(), prefix);
+
+  for(auto itr = beg; itr != _forward.end() && itr->substr(0, prefix.size()) == prefix; ++itr) {
+    if(std::regex_match(itr->begin(), itr->end(), re)) {
+      names.push_back(*itr);
+    }
+  }
+
+  return names;
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
@@ -0,0 +1,84 @@
+#ifndef OT_UTILITY_PATTERN_HPP_
+#define OT_UTILITY_PATTERN_HPP_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+
+namespace ot {
+
+// Function: is_pattern
+// Check whether a name contains glob wildcards (* or ?). Brackets are literal so bus
+// names such as data[3] match themselves.
+bool is_pattern(std::string_view);
+
+// Function: glob_match
+bool glob_match(std::string_view, std::string_view);
+
+// Class: NameIndex
+// A sorted index over the names of a set of objects. A glob pattern is resolved over the
+// names sharing its literal prefix (forward order) or literal suffix (order of reversed
+// names), whichever is longer, and a regular expression over the names sharing its
+// literal prefix, such that only a narrow range of names is actually matched.
+// The index refers to the names without copying them and must be rebuilt (invalidated)
+// whenever a name is inserted or removed.
+class NameIndex {
+
+  public:
+
+    template <typename C>
+    void build(const C&);
+
+    inline void invalidate();
+    inline bool is_valid() const;
+    inline size_t size() const;
+
+    std::vector<std::string_view> match(std::string_view, bool = false) const;
+
+  private:
+
+    bool _valid {false};
+
+    std::vector<std::string_view> _forward;
+    std::vector<std::string_view> _backward;
+
+    std::vector<std::string_view> _glob(std::string_view) const;
+    std::vector<std::string_view> _regex(std::string_view) const;
+
+    void _sort();
+};
+
+// Procedure: build
+// Index the keys of a map.
+template <typename C>
+void NameIndex::build(const C& map) {
+
+  _forward.clear();
+  _forward.reserve(map.size());
+
+  for(const auto& kvp : map) {
+    _forward.emplace_back(kvp.first);
+  }
+
+  _sort();
+}
+
+// Procedure: invalidate
+inline void NameIndex::invalidate() {
+  _valid = false;
+}
+
+// Function: is_valid
+inline bool NameIndex::is_valid() const {
+  return _valid;
+}
+
+// Function: size
+inline size_t NameIndex::size() const {
+  return _forward.size();
+}
+
+};  // end of namespace ot. -----------------------------------------------------------------------
+
+#endif
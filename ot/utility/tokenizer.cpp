@@ -1,4 +1,5 @@
 #include <ot/utility/tokenizer.hpp>
+#include <ot/utility/mmap.hpp>
 
 // TODO
 // 1. Consider removing the utf-8 bom (https://github.com/zer4tul/utf8-bom-strip)
@@ -79,99 +80,85 @@ std::vector<std::string> split(const std::string& str, std::string_view dels) {
 
 //-------------------------------------------------------------------------------------------------
 
-// Function: tokenize:
-std::vector<std::string> tokenize(
-  const std::filesystem::path& path, 
+// Function: tokenize
+// Split a buffer into views of tokens on whitespace and the given delimiters, skipping block
+// (/* */), line (//), and pound (#) comments. Delimiters that are also exceptions are
+// returned as single-character tokens.
+std::vector<std::string_view> tokenize(
+  std::string_view buffer,
   std::string_view dels,
   std::string_view exps
 ) {
-  
-  using namespace std::literals::string_literals;
 
-  std::ifstream ifs(path, std::ios::ate);
+  std::vector<std::string_view> tokens;
+  tokens.reserve(buffer.size() / 8);
 
-  if(!ifs.good()) {
-    //throw std::invalid_argument("failed to open the file '"s + path.c_str() + '\'');
-    return {};
-  }
-  
-  // Read the file to a local buffer.
-  size_t fsize = ifs.tellg();
-  ifs.seekg(0, std::ios::beg);
-  std::vector<char> buffer(fsize + 1);
-  ifs.read(buffer.data(), fsize);
-  buffer[fsize] = 0;
-  
-  // Mart out the comment
-  for(size_t i=0; i<fsize; ++i) {
+  const char* beg = buffer.data();
+  const char* end = buffer.data() + buffer.size();
+  const char* token {nullptr};
 
-    // Block comment
-    if(buffer[i] == '/' && buffer[i+1] == '*') {
-      buffer[i] = buffer[i+1] = ' ';
-      for(i=i+2; i<fsize; buffer[i++]=' ') {
-        if(buffer[i] == '*' && buffer[i+1] == '/') {
-          buffer[i] = buffer[i+1] = ' ';
-          i = i+1;
-          break;
-        }
-      }
+  auto flush = [&] (const char* itr) {
+    if(token) {
+      tokens.emplace_back(token, itr - token);
+      token = nullptr;
     }
+  };
+
+  for(const char* itr = beg; itr < end; ++itr) {
+
+    auto c = *itr;
     
-    // Line comment
-    if(buffer[i] == '/' && buffer[i+1] == '/') {
-      buffer[i] = buffer[i+1] = ' ';
-      for(i=i+2; i<fsize; ++i) {
-        if(buffer[i] == '\n' || buffer[i] == '\r') {
-          break;
-        }
-        else buffer[i] = ' ';
-      }
+    // Block comment
+    if(c == '/' && itr + 1 < end && itr[1] == '*') {
+      flush(itr);
+      for(itr += 2; itr + 1 < end && !(itr[0] == '*' && itr[1] == '/'); ++itr);
+      itr = std::min(itr + 1, end - 1);
+      continue;
     }
     
-    // Pond comment
-    if(buffer[i] == '#') {
-      buffer[i] = ' ';
-      for(i=i+1; i<fsize; ++i) {
-        if(buffer[i] == '\n' || buffer[i] == '\r') {
-          break;
-        }
-        else buffer[i] = ' ';
-      }
+    // Line comment or pound comment
+    if((c == '/' && itr + 1 < end && itr[1] == '/') || c == '#') {
+      flush(itr);
+      for(; itr + 1 < end && itr[1] != '\n' && itr[1] != '\r'; ++itr);
+      continue;
     }
-  }
-
-  //std::cout << std::string_view(buffer.data()) << std::endl;
-
-  // Parse the token.
-  std::string token;
-  std::vector<std::string> tokens;
-
-  for(size_t i=0; i<fsize; ++i) {
 
-    auto c = buffer[i];
     bool is_del = (dels.find(c) != std::string_view::npos);
 
     if(is_del || std::isspace(c)) {
-      if(!token.empty()) {                            // Add the current token.
-        tokens.push_back(std::move(token));
-        token.clear();
-      }
+      flush(itr);
       if(is_del && exps.find(c) != std::string_view::npos) {
-        token.push_back(c);
-        tokens.push_back(std::move(token));
+        tokens.emplace_back(itr, 1);
       }
-    } else {
-      token.push_back(c);  // Add the char to the current token.
+    }
+    else if(!token) {
+      token = itr;
     }
   }
 
-  if(!token.empty()) {
-    tokens.push_back(std::move(token));
-  }
+  flush(end);
 
   return tokens;
 }
 
+// Function: tokenize
+std::vector<std::string> tokenize(
+  const std::filesystem::path& path, 
+  std::string_view dels,
+  std::string_view exps
+) {
+
+  MappedFile file(path);
+
+  if(!file.is_open()) {
+    return {};
+  }
+
+  auto views = tokenize(file.view(), dels, exps);
+
+  return std::vector<std::string>(views.begin(), views.end());
+}
+
 };  // end of namespace ot. -----------------------------------------------------------------------
 
 
@@ -126,6 +126,9 @@ auto on_next_parentheses(const I b, const I e, C&& c) {
 // Function: tokenize
 std::vector<std::string> tokenize(const std::filesystem::path&, std::string_view="", std::string_view="");
 
+// Function: tokenize
+std::vector<std::string_view> tokenize(std::string_view, std::string_view="", std::string_view="");
+
 // Function: split
 std::vector<std::string> split(const std::string&, std::string_view="");
 
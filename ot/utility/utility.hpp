@@ -4,7 +4,10 @@
 #include <ot/utility/lambda.hpp>
 #include <ot/utility/logger.hpp>
 #include <ot/utility/tokenizer.hpp>
+#include <ot/utility/mmap.hpp>
+#include <ot/utility/compress.hpp>
 #include <ot/utility/index.hpp>
+#include <ot/utility/pattern.hpp>
 #include <ot/utility/os.hpp>
 #include <ot/utility/scope_guard.hpp>
 #include <ot/utility/unique_guard.hpp>
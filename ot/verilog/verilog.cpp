@@ -68,71 +68,138 @@ std::string Module::info() const {
          "[gates:" + std::to_string(gates.size()) + "]";
 }
 
-// Procedure: read_verilog
-Module read_verilog(const std::filesystem::path& path) {
+// Function: module
+// Find a module by name.
+const Module* Netlist::module(const std::string& name) const {
+  for(const auto& m : modules) {
+    if(m.name == name) {
+      return &m;
+    }
+  }
+  return nullptr;
+}
+
+// Function: top
+// The top module is the (last defined) module not instantiated by any other module.
+const Module* Netlist::top() const {
+
+  std::unordered_set<std::string_view> instantiated;
+
+  for(const auto& m : modules) {
+    for(const auto& gate : m.gates) {
+      instantiated.insert(gate.cell);
+    }
+  }
+
+  for(auto itr = modules.rbegin(); itr != modules.rend(); ++itr) {
+    if(instantiated.find(itr->name) == instantiated.end()) {
+      return &(*itr);
+    }
+  }
+
+  return nullptr;
+}
+
+// Function: info
+std::string Netlist::info() const {
+
+  if(modules.size() == 1) {
+    return modules.front().info();
+  }
+
+  auto t = top();
+
+  return "verilog netlist \""s + (t ? t->name : ""s) + "\" " + 
+         "[modules:" + std::to_string(modules.size()) + "]";
+}
+
+// Operator: <<
+std::ostream& operator << (std::ostream& os, const Netlist& netlist) {
+  for(size_t i=0; i<netlist.modules.size(); ++i) {
+    if(i != 0) {
+      os << "\n\n";
+    }
+    os << netlist.modules[i];
+  }
+  return os;
+}
+
+// ------------------------------------------------------------------------------------------------
 
-  Module module;
+// Function: read_statements
+// Parse a buffer of whole statements into the netlist. Statements of a module body go to the
+// last module of the netlist as long as inside is true, i.e., until the endmodule.
+void read_statements(Netlist& netlist, std::string_view buffer, bool& inside) {
   
   static std::string_view delimiters = "(),:;/#[]{}*\"\\";
   static std::string_view exceptions = "().;";
   
-  auto tokens = tokenize(path, delimiters, exceptions);
-
-  //for(const auto& token : tokens) {
-  //  std::cout << token << std::endl;
-  //}
+  auto tokens = tokenize(buffer, delimiters, exceptions);
 
   // Set up the iterator
   auto itr = tokens.begin();
   auto end = tokens.end();
 
-  // Read the module name
-  if(itr = std::find(itr, end, "module"); itr == end) {
-    OT_LOGF("can't find keyword 'module'");
-  }
-  else {
-    if(++itr == end) {
-      OT_LOGF("syntax error in module name");
-    }
-    module.name = std::move(*itr);
-  }
+  for(; itr != end; ++itr) {
+
+    // Read the module name and ports (anything else outside modules is skipped)
+    if(!inside || *itr == "module") {
+
+      if(*itr != "module") {
+        continue;
+      }
+
+      auto& module = netlist.modules.emplace_back();
+
+      if(++itr == end) {
+        OT_LOGF("syntax error in module name");
+      }
+      module.name = *itr;
 
-  while(++itr != end && *itr != ";") {
-    if(*itr != "(" && *itr != ")") {
-      module.ports.push_back(std::move(*itr));
+      while(++itr != end && *itr != ";") {
+        if(*itr != "(" && *itr != ")") {
+          module.ports.emplace_back(*itr);
+        }
+      }
+
+      if(itr == end) {
+        break;
+      }
+
+      inside = true;
+      continue;
     }
-  }
 
-  // Parse the content.
-  while(++itr != end) {
+    // Parse the content.
+    auto& module = netlist.modules.back();
     
     if(*itr == "endmodule") {
-      break;
+      inside = false;
     }
     else if(*itr == "input") {
       while(++itr != end && *itr != ";") {
-        module.inputs.push_back(std::move(*itr));
+        module.inputs.emplace_back(*itr);
       }
     }
     else if(*itr == "output") {
       while(++itr != end && *itr != ";") {
-        module.outputs.push_back(std::move(*itr));
+        module.outputs.emplace_back(*itr);
       }
     }
     else if(*itr == "wire") {
       while(++itr != end && *itr != ";") {
-        module.wires.push_back(std::move(*itr));
+        module.wires.emplace_back(*itr);
       }
     }
     else {
       
       Gate inst;
-      inst.cell = std::move(*itr);
+      inst.cell = *itr;
 
       if(++itr == end) {
         OT_LOGF("syntax error in cell ", inst.cell, ")");
       }
-      inst.name = std::move(*itr);
+      inst.name = *itr;
 
       // Read the mapping
       std::string cellpin;
@@ -148,7 +215,6 @@ Module read_verilog(const std::filesystem::path& path) {
         else {
           net = str; 
           inst.cellpin2net[cellpin] = net;
-          inst.net2cellpin[net] = cellpin;
         }
       });
 
@@ -156,17 +222,172 @@ Module read_verilog(const std::filesystem::path& path) {
         OT_LOGF("syntax error in gate pin-net mapping");
       }
 
-      if(*(++itr) != ";") {
+      if(++itr == end || *itr != ";") {
         OT_LOGF("missing ; in instance declaration");
       }
       
       module.gates.push_back(std::move(inst));
     }
+
+    if(itr == end) {
+      break;
+    }
+  }
+}
+
+// Function: end_of_statement
+// Return the position after the first semicolon outside comments at or after position i, 
+// or std::string_view::npos if there is none.
+size_t end_of_statement(std::string_view buf, size_t i) {
+  for(; i<buf.size(); ++i) {
+    if(buf[i] == '/' && i+1 < buf.size() && buf[i+1] == '*') {
+      if(i = buf.find("*/", i+2); i == std::string_view::npos) {
+        break;
+      }
+      ++i;
+    }
+    else if((buf[i] == '/' && i+1 < buf.size() && buf[i+1] == '/') || buf[i] == '#') {
+      if(i = buf.find('\n', i+1); i == std::string_view::npos) {
+        break;
+      }
+    }
+    else if(buf[i] == ';') {
+      return i + 1;
+    }
+  }
+  return std::string_view::npos;
+}
+
+// Function: split_statements
+// Split a buffer of statements into up to N chunks of whole statements with at least
+// min_size bytes each (except the last one).
+std::vector<std::string_view> split_statements(std::string_view buf, size_t N, size_t min_size) {
+
+  std::vector<std::string_view> chunks;
+
+  N = std::clamp<size_t>(buf.size() / std::max<size_t>(min_size, 1), 1, std::max<size_t>(N, 1));
+
+  for(size_t k=1, beg=0; beg < buf.size(); ++k) {
+    size_t end = beg;
+    while(k < N && end < buf.size() * k / N) {
+      if(end = end_of_statement(buf, end); end == std::string_view::npos) {
+        break;
+      }
+    }
+    if(k >= N || end == std::string_view::npos) {
+      end = buf.size();
+    }
+    if(end > beg) {
+      chunks.push_back(buf.substr(beg, end - beg));
+    }
+    beg = end;
+  }
+
+  return chunks;
+}
+
+// Procedure: read_verilog
+// Read a verilog netlist of one or more modules with the given subflow. A plain netlist is
+// parsed in chunks of whole statements concurrently, and the chunks are merged in file order 
+// (a chunk other than the first starts in the body of the last module of its predecessor). 
+// A compressed netlist is streamed and parsed serially.
+Netlist read_verilog(const std::filesystem::path& path, tf::Subflow& sf) {
+
+  Netlist netlist;
+
+  // Compressed netlists are streamed in chunks of whole statements, i.e., each chunk is cut
+  // after the last semicolon outside comments.
+  if(compression(path) != Compression::NONE) {
+
+    auto cut = [] (std::string_view buf) {
+      size_t pos {0};
+      for(size_t i=0; (i = end_of_statement(buf, i)) != std::string_view::npos; ) {
+        pos = i;
+      }
+      return pos;
+    };
+
+    bool inside {false};
+
+    auto consume = [&] (std::string& chunk) {
+      read_statements(netlist, chunk, inside);
+    };
+
+    if(!read_chunks(path, cut, consume)) {
+      OT_LOGF("failed to read verilog ", path);
+    }
+  }
+  else {
+    MappedFile file(path);
+
+    if(!file.is_open()) {
+      OT_LOGF("failed to open verilog ", path);
+    }
+
+    auto chunks = split_statements(file.view(), sf.executor().num_workers(), 1 << 20);
+
+    std::vector<Netlist> parts(chunks.size());
+
+    sf.for_each_index(size_t{0}, chunks.size(), size_t{1}, [&] (size_t k) {
+      bool inside = (k != 0);
+      if(inside) {
+        parts[k].modules.emplace_back();
+      }
+      read_statements(parts[k], chunks[k], inside);
+    });
+
+    sf.join();
+
+    auto append = [] (auto& to, auto& from) {
+      to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+    };
+
+    for(size_t k=0; k<parts.size(); ++k) {
+      
+      auto beg = parts[k].modules.begin();
+
+      if(k != 0) {
+        if(!netlist.modules.empty()) {
+          auto& module = netlist.modules.back();
+          append(module.inputs, beg->inputs);
+          append(module.outputs, beg->outputs);
+          append(module.wires, beg->wires);
+          append(module.gates, beg->gates);
+        }
+        ++beg;
+      }
+
+      netlist.modules.insert(
+        netlist.modules.end(), 
+        std::make_move_iterator(beg), 
+        std::make_move_iterator(parts[k].modules.end())
+      );
+    }
+  }
+
+  if(netlist.modules.empty()) {
+    OT_LOGF("can't find keyword 'module'");
   }
   
-  return module;
+  return netlist;
 }
 
+// Procedure: read_verilog
+// Read a verilog netlist.
+Netlist read_verilog(const std::filesystem::path& path) {
+
+  Netlist netlist;
+
+  tf::Executor executor;
+  tf::Taskflow taskflow;
 
+  taskflow.emplace([&] (tf::Subflow& sf) {
+    netlist = read_verilog(path, sf);
+  });
+
+  executor.run(taskflow).wait();
+
+  return netlist;
+}
 
 };  // end of namespace ot. -----------------------------------------------------------------------
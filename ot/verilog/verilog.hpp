@@ -13,7 +13,6 @@ struct Gate {
   std::string name;
   std::string cell;
   std::unordered_map<std::string, std::string> cellpin2net;
-  std::unordered_map<std::string, std::string> net2cellpin;
 };
 
 std::ostream& operator << (std::ostream&, const Gate&);
@@ -35,7 +34,23 @@ std::ostream& operator << (std::ostream&, const Module&);
 
 // ------------------------------------------------------------------------------------------------
 
-Module read_verilog(const std::filesystem::path&);
+// Struct: Netlist
+// The modules of a (hierarchical) netlist. A gate whose cell names another module of the
+// netlist is an instance of that module. Each module is parsed once and its description is 
+// shared by all of its instances, i.e., the hierarchy is never flattened in the netlist.
+struct Netlist {
+  std::vector<Module> modules;
+  const Module* module(const std::string&) const;
+  const Module* top() const;
+  std::string info() const;
+};
+
+std::ostream& operator << (std::ostream&, const Netlist&);
+
+// ------------------------------------------------------------------------------------------------
+
+Netlist read_verilog(const std::filesystem::path&);
+Netlist read_verilog(const std::filesystem::path&, tf::Subflow&);
 
 };  // end of namespace ot. -----------------------------------------------------------------------
 
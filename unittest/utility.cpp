@@ -2,6 +2,15 @@
 
 #include "doctest.h"
 #include <ot/utility/utility.hpp>
+#include <ot/spef/binary.hpp>
+#include <ot/verilog/verilog.hpp>
+#include <ot/timer/power.hpp>
+#include <ot/config.hpp>
+#include <fstream>
+
+#ifdef OT_WITH_ZLIB
+#include <zlib.h>
+#endif
 
 // Testcase: Tokenizer.IsWord
 TEST_CASE("Tokenizer.IsWord") {
@@ -128,9 +137,279 @@ TEST_CASE("Tokenizer.Bracket") {
   REQUIRE((b6 == str6.begin() + 3 && e6 == str6.begin() + str6.size() - 5));
 }
 
+// Testcase: Tokenizer.View
+TEST_CASE("Tokenizer.View") {
+
+  std::string_view str1 = "a b\tc\n";
+  std::string_view str2 = "a /* b\n c */ d // e\nf # g\nh";
+  std::string_view str3 = "cell(INV) { a : 1.0; }";
+  std::string_view str4 = "x /* unterminated";
+
+  REQUIRE((ot::tokenize(str1) == std::vector<std::string_view>{"a", "b", "c"}));
+  REQUIRE((ot::tokenize(str2) == std::vector<std::string_view>{"a", "d", "f", "h"}));
+  REQUIRE((
+    ot::tokenize(str3, "(){}:;", "(){}") == 
+    std::vector<std::string_view>{"cell", "(", "INV", ")", "{", "a", "1.0", "}"}
+  ));
+  REQUIRE((ot::tokenize(str4) == std::vector<std::string_view>{"x"}));
+
+  // tokens are views into the buffer
+  auto tokens = ot::tokenize(str3, "(){}:;", "(){}");
+  REQUIRE(tokens[2].data() == str3.data() + 5);
+}
+
+// Testcase: Compress.Chunks
+TEST_CASE("Compress.Chunks") {
+
+  std::string text;
+  for(int i=0; i<1000; ++i) {
+    text += "line " + std::to_string(i) + '\n';
+  }
+
+  auto plain = std::filesystem::temp_directory_path() / "ot_compress_chunks.txt";
+  std::ofstream(plain) << text;
+
+  // chunks end at whole lines and add up to the content
+  auto check = [&] (const std::filesystem::path& path) {
+    std::string content;
+    size_t num_chunks {0};
+    auto cut = [] (std::string_view buf) {
+      auto pos = buf.rfind('\n');
+      return pos == std::string_view::npos ? 0 : pos + 1;
+    };
+    REQUIRE(ot::read_chunks(path, cut, [&] (std::string& chunk) {
+      REQUIRE(chunk.back() == '\n');
+      REQUIRE(chunk.c_str()[chunk.size()] == 0);
+      content += chunk;
+      ++num_chunks;
+    }, 64));
+    REQUIRE(content == text);
+    REQUIRE(num_chunks > 1);
+  };
+
+  REQUIRE(ot::compression(plain) == ot::Compression::NONE);
+  check(plain);
+
+#ifdef OT_WITH_ZLIB
+  auto gz = std::filesystem::temp_directory_path() / "ot_compress_chunks.txt.gz";
+  auto file = ::gzopen(gz.c_str(), "wb");
+  REQUIRE(file != nullptr);
+  ::gzwrite(file, text.data(), text.size());
+  ::gzclose(file);
+
+  REQUIRE(ot::compression(gz) == ot::Compression::GZIP);
+  REQUIRE(ot::decompress(gz) == text);
+  check(gz);
+
+  std::filesystem::remove(gz);
+#endif
+
+  std::filesystem::remove(plain);
+}
+
+// Testcase: BinarySpef.RoundTrip
+TEST_CASE("BinarySpef.RoundTrip") {
+
+  std::string text = 
+    "*SPEF \"IEEE 1481-1998\"\n"
+    "*DESIGN \"simple\"\n"
+    "*DIVIDER /\n"
+    "*DELIMITER :\n"
+    "*BUS_DELIMITER []\n"
+    "*T_UNIT 1 PS\n"
+    "*C_UNIT 1 FF\n"
+    "*R_UNIT 1 KOHM\n"
+    "*L_UNIT 1 UH\n"
+    "\n"
+    "*NAME_MAP\n"
+    "*1 inp1\n"
+    "*2 u1\n"
+    "*3 n1\n"
+    "\n"
+    "*D_NET *3 2.5\n"
+    "*CONN\n"
+    "*P *1 I *C 1.0 2.0 *L 0.5\n"
+    "*I *2:a I *D NAND2_X1\n"
+    "*CAP\n"
+    "1 *3:1 1.5\n"
+    "2 *3:1 *2:a 0.25\n"
+    "*RES\n"
+    "1 *1 *3:1 3.5\n"
+    "2 *3:1 *2:a 4.5\n"
+    "*END\n"
+    "\n"
+    "*D_NET *1 1.0\n"
+    "*CONN\n"
+    "*P *1 I\n"
+    "*END\n";
+
+  spef::Spef spef;
+  REQUIRE(spef.read(text.data(), text.size()));
+  spef.expand_name();
+  REQUIRE(spef.nets.size() == 2);
+
+  auto path = std::filesystem::temp_directory_path() / "ot_binary_spef.bin";
+
+  REQUIRE(ot::BinarySpef::write(spef, path));
+  REQUIRE(ot::BinarySpef::is_binary(path));
+
+  ot::BinarySpef binary;
+  REQUIRE(binary.open(path));
+  REQUIRE(binary.num_nets() == 2);
+
+  // random access by name
+  for(const auto& net : spef.nets) {
+    auto copy = binary.net(net.name);
+    REQUIRE(copy);
+    REQUIRE(copy->name == net.name);
+    REQUIRE(copy->lcap == net.lcap);
+    REQUIRE(copy->caps == net.caps);
+    REQUIRE(copy->ress == net.ress);
+    REQUIRE(copy->connections.size() == net.connections.size());
+    for(size_t i=0; i<net.connections.size(); ++i) {
+      REQUIRE(copy->connections[i].name == net.connections[i].name);
+      REQUIRE(copy->connections[i].type == net.connections[i].type);
+      REQUIRE(copy->connections[i].direction == net.connections[i].direction);
+      REQUIRE(copy->connections[i].load == net.connections[i].load);
+      REQUIRE(copy->connections[i].coordinate == net.connections[i].coordinate);
+      REQUIRE(copy->connections[i].driving_cell == net.connections[i].driving_cell);
+    }
+  }
+
+  REQUIRE(!binary.net("n2"));
+
+  spef::Spef header;
+  binary.read_header(header);
+  REQUIRE(header.capacitance_unit == spef.capacitance_unit);
+  REQUIRE(header.resistance_unit == spef.resistance_unit);
+
+  std::filesystem::remove(path);
+}
+
+// Testcase: Pattern.NameIndex
+TEST_CASE("Pattern.NameIndex") {
+
+  REQUIRE(ot::is_pattern("u1/*") == true);
+  REQUIRE(ot::is_pattern("data[3]") == false);
+  REQUIRE(ot::glob_match("data_in[*]", "data_in[12]") == true);
+  REQUIRE(ot::glob_match("u?/D", "u1/D") == true);
+  REQUIRE(ot::glob_match("u?/D", "u12/D") == false);
+  REQUIRE(ot::glob_match("*", "") == true);
+
+  std::unordered_map<std::string, int> map {
+    {"u1/D", 0}, {"u1/Q", 1}, {"u12/D", 2}, {"u2/CK", 3}, 
+    {"data_in[0]", 4}, {"data_in[1]", 5}, {"data_out[0]", 6}
+  };
+
+  ot::NameIndex index;
+
+  REQUIRE(index.is_valid() == false);
+
+  index.build(map);
+
+  REQUIRE(index.is_valid() == true);
+  REQUIRE(index.size() == map.size());
+
+  using names = std::vector<std::string_view>;
+
+  REQUIRE(index.match("u1/D") == names{"u1/D"});
+  REQUIRE(index.match("u3/D").empty());
+  REQUIRE(index.match("*/D") == names{"u1/D", "u12/D"});
+  REQUIRE(index.match("u1*") == names{"u1/D", "u1/Q", "u12/D"});
+  REQUIRE(index.match("data_in[*]") == names{"data_in[0]", "data_in[1]"});
+  REQUIRE(index.match("*[0]") == names{"data_in[0]", "data_out[0]"});
+  REQUIRE(index.match("u1/.", true) == names{"u1/D", "u1/Q"});
+  REQUIRE(index.match("u[0-9]+/(D|CK)", true) == names{"u1/D", "u12/D", "u2/CK"});
+  REQUIRE(index.match("data_(in|out)\\[0\\]", true) == names{"data_in[0]", "data_out[0]"});
+
+  REQUIRE(index.match("u2/CK|u1/Q", true) == names{"u1/Q", "u2/CK"});
+
+  index.invalidate();
+
+  REQUIRE(index.is_valid() == false);
+}
+
+// Testcase: Verilog.Hierarchy
+TEST_CASE("Verilog.Hierarchy") {
+
+  auto path = std::filesystem::temp_directory_path() / "ot_verilog_hierarchy.v";
 
+  {
+    std::ofstream ofs(path);
+    ofs << "module half (a, b, y);\n"
+        << "input a, b;\n"
+        << "output y;\n"
+        << "wire n1;\n"
+        << "NAND2_X1 u1 ( .A1(a), .A2(b), .ZN(n1) );\n"
+        << "INV_X1 u2 ( .A(n1), .ZN(y) );\n"
+        << "endmodule\n"
+        << "\n"
+        << "module top (x, y, z);\n"
+        << "input x, y;\n"
+        << "output z;\n"
+        << "wire w;\n"
+        << "half h1 ( .a(x), .b(y), .y(w) );\n"
+        << "half h2 ( .a(w), .b(y), .y(z) );\n"
+        << "endmodule\n";
+  }
 
+  auto netlist = ot::vlog::read_verilog(path);
 
+  REQUIRE(netlist.modules.size() == 2);
+  REQUIRE(netlist.module("half") != nullptr);
+  REQUIRE(netlist.module("half")->gates.size() == 2);
+  REQUIRE(netlist.module("none") == nullptr);
+  REQUIRE(netlist.top() == netlist.module("top"));
+  REQUIRE(netlist.top()->gates.size() == 2);
+  REQUIRE(netlist.top()->gates[1].cell == "half");
+  REQUIRE(netlist.top()->gates[1].cellpin2net.at("y") == "z");
+
+  std::filesystem::remove(path);
+}
 
+// Testcase: Liberty.LogicFunction
+TEST_CASE("Liberty.LogicFunction") {
 
+  auto nand = ot::compile_logic_function("(!(A1 A2))");
+  REQUIRE(nand);
+  REQUIRE(nand->variables == std::vector<std::string>{"A1", "A2"});
+  REQUIRE(nand->truth_table == std::vector<bool>{1, 1, 1, 0});
 
+  auto aoi = ot::compile_logic_function("!((A B) + C)");
+  REQUIRE(aoi);
+  REQUIRE(aoi->variables.size() == 3);
+  REQUIRE((*aoi)(0b011) == false);
+  REQUIRE((*aoi)(0b100) == false);
+  REQUIRE((*aoi)(0b001) == true);
+
+  auto mux = ot::compile_logic_function("(S&B) | (S'&A)");
+  REQUIRE(mux);
+  REQUIRE(mux->variables == std::vector<std::string>{"S", "B", "A"});
+  REQUIRE((*mux)(0b011) == true);
+  REQUIRE((*mux)(0b100) == true);
+  REQUIRE((*mux)(0b101) == false);
+
+  REQUIRE(ot::compile_logic_function("A ^ B ^ 1")->truth_table == std::vector<bool>{1, 0, 0, 1});
+  REQUIRE(!ot::compile_logic_function("(A + B"));
+  REQUIRE(!ot::compile_logic_function("A +"));
+  REQUIRE(!ot::compile_logic_function(""));
+}
+
+// Testcase: Power.PropagateActivity
+TEST_CASE("Power.PropagateActivity") {
+
+  auto and2 = ot::compile_logic_function("A B");
+  auto xor2 = ot::compile_logic_function("A ^ B");
+
+  std::vector<ot::Activity> inputs {{0.2f, 0.5f}, {0.4f, 0.25f}};
+
+  // P(y) = P(A)P(B), D(y) = P(B)D(A) + P(A)D(B)
+  auto a = ot::propagate_activity(*and2, inputs);
+  REQUIRE(a.static_probability == doctest::Approx(0.125f));
+  REQUIRE(a.toggle_rate == doctest::Approx(0.25f * 0.2f + 0.5f * 0.4f));
+
+  // an xor output toggles with either input
+  auto x = ot::propagate_activity(*xor2, inputs);
+  REQUIRE(x.static_probability == doctest::Approx(0.5f));
+  REQUIRE(x.toggle_rate == doctest::Approx(0.6f));
+}